@@ -27,7 +27,53 @@ from pathlib import Path
 from nagini.compiler import NaginiParser, NaginiIR, LLVMBackend
 
 
-def compile_file(input_file: str, output_file: str = None, emit_c: bool = False, verbose: bool = False):
+def _build_cache_dir(source_code: str, rt_cache: bool, pgo: bool) -> str:
+    """Content-addressed cache slot for one compilation.
+
+    The key hashes everything that determines the produced artifacts: the
+    program source, the CLI options that change how it is built, the
+    compiler's own Python sources and the C runtime sources. Editing any
+    of them (including the compiler itself) changes the key, so stale
+    artifacts are never reused and no explicit invalidation is needed.
+    Mirrors the ~/.cache/nagini/rt layout used for the precompiled
+    runtime library.
+    """
+    import hashlib
+    import os
+    from nagini.compiler import backend, ir, parser
+    from nagini.compiler.backend import load_c_from_file
+
+    pieces = [source_code, f'rt_cache={rt_cache}', f'pgo={pgo}']
+    for module in (parser, ir, backend):
+        with open(module.__file__, 'r') as f:
+            pieces.append(f.read())
+    for runtime_file in ('hmap.h', 'pool.h', 'builtin.h'):
+        pieces.append(load_c_from_file(runtime_file))
+    key = hashlib.sha256('\x00'.join(pieces).encode('utf-8')).hexdigest()[:16]
+    return os.path.join(os.path.expanduser('~'), '.cache', 'nagini', 'bin', key)
+
+
+def _store_cached_build(cache_dir: str, c_code: str, binary_path: str = None):
+    """Populate a cache slot with the generated C (and the linked binary
+    when one was built). Artifacts land under their final name via a
+    rename so a concurrent invocation never sees a half-written file.
+    """
+    import os
+    import shutil
+
+    os.makedirs(cache_dir, exist_ok=True)
+    tmp_c = os.path.join(cache_dir, f'.program.c.{os.getpid()}')
+    with open(tmp_c, 'w') as f:
+        f.write(c_code)
+    os.replace(tmp_c, os.path.join(cache_dir, 'program.c'))
+    if binary_path is not None:
+        tmp_bin = os.path.join(cache_dir, f'.program.{os.getpid()}')
+        shutil.copy2(binary_path, tmp_bin)
+        os.replace(tmp_bin, os.path.join(cache_dir, 'program'))
+
+
+def compile_file(input_file: str, output_file: str = None, emit_c: bool = False, verbose: bool = False,
+                 rt_cache: bool = False, pgo: bool = False, no_cache: bool = False):
     """
     Compile a Nagini source file to an executable.
     
@@ -40,7 +86,16 @@ def compile_file(input_file: str, output_file: str = None, emit_c: bool = False,
         output_file: Path to output executable (default: same name as input without extension)
         emit_c: If True, output the generated C code instead of compiling to executable
         verbose: Print detailed information about each compilation phase
-        
+        rt_cache: If True, link against a precompiled runtime library
+            (built once per toolchain and cached) instead of recompiling
+            the runtime sources for every program
+        pgo: If True, run the profile-guided optimization pipeline:
+            build an instrumented binary, execute it once as the training
+            workload, then rebuild with the collected profile
+            (-fprofile-generate / -fprofile-use)
+        no_cache: If True, skip the content-addressed build cache and
+            run every phase even for unchanged source
+
     Returns:
         0 on success, 1 on failure
     """
@@ -58,7 +113,33 @@ def compile_file(input_file: str, output_file: str = None, emit_c: bool = False,
     
     if verbose:
         print(f"Compiling {input_file}...")
-    
+
+    # Determine output path (default to input filename without extension)
+    if output_file is None:
+        output_file = Path(input_file).stem
+
+    # ========== Build Cache Lookup ==========
+    # On a hit the cached artifact is copied out and all four phases are
+    # skipped; unchanged sources rebuild in milliseconds instead of
+    # seconds. The key covers source, options, compiler and runtime, so a
+    # hit is always byte-equivalent to a fresh build.
+    cache_dir = None
+    if not no_cache:
+        import shutil
+        cache_dir = _build_cache_dir(source_code, rt_cache, pgo)
+        cached_artifact = str(Path(cache_dir) / ('program.c' if emit_c else 'program'))
+        if Path(cached_artifact).exists():
+            if emit_c:
+                c_output = f"{output_file}.c"
+                shutil.copy2(cached_artifact, c_output)
+                print(f"Generated C code written to: {c_output} (cached)")
+            else:
+                shutil.copy2(cached_artifact, output_file)
+                print(f"Successfully compiled to: {output_file} (cached)")
+            return 0
+        if verbose:
+            print(f"  Cache miss; will store result in {cache_dir}")
+
     # ========== Phase 1: Parse AST ==========
     # Use Python's AST parser to extract class and function definitions
     if verbose:
@@ -86,19 +167,17 @@ def compile_file(input_file: str, output_file: str = None, emit_c: bool = False,
     # Generate C code from the IR
     if verbose:
         print("Phase 3: Generating C code...")
-    backend = LLVMBackend(ir)
+    backend = LLVMBackend(ir, separate_runtime=rt_cache)
     c_code = backend.generate()
     
-    # Determine output path (default to input filename without extension)
-    if output_file is None:
-        output_file = Path(input_file).stem
-    
     # If emit_c flag is set, write C code to file and exit
     # This is useful for debugging or examining generated code
     if emit_c:
         c_output = f"{output_file}.c"
         with open(c_output, 'w') as f:
             f.write(c_code)
+        if cache_dir is not None:
+            _store_cached_build(cache_dir, c_code)
         print(f"Generated C code written to: {c_output}")
         return 0
     
@@ -106,10 +185,45 @@ def compile_file(input_file: str, output_file: str = None, emit_c: bool = False,
     # Use system C compiler (gcc/clang) to create executable
     if verbose:
         print(f"Phase 4: Compiling to executable: {output_file}...")
-    
-    success = backend.compile_to_executable(output_file, c_code)
+
+    if pgo:
+        # PGO pipeline: instrumented build -> training run -> optimized
+        # rebuild. The program itself is the training workload, so it
+        # should exercise representative hot paths when run standalone.
+        import os
+        import subprocess
+        import tempfile
+
+        profile_dir = tempfile.mkdtemp(prefix='nagini_pgo_')
+        if verbose:
+            print(f"  PGO: instrumented build (profile data in {profile_dir})...")
+        success = backend.compile_to_executable(
+            output_file, c_code, extra_flags=[f'-fprofile-generate={profile_dir}'])
+        if not success:
+            print("PGO: instrumented build failed.")
+            return 1
+
+        if verbose:
+            print("  PGO: training run...")
+        result = subprocess.run([os.path.abspath(output_file)],
+                                stdout=subprocess.DEVNULL)
+        if result.returncode != 0:
+            print(f"PGO: training run exited with {result.returncode}; "
+                  "continuing with the partial profile.")
+
+        if verbose:
+            print("  PGO: optimized rebuild...")
+        # -fprofile-correction tolerates the slightly inconsistent counts
+        # a signal-interrupted (e.g. profiled) training run can leave
+        success = backend.compile_to_executable(
+            output_file, c_code,
+            extra_flags=[f'-fprofile-use={profile_dir}', '-fprofile-correction'])
+    else:
+        success = backend.compile_to_executable(output_file, c_code)
     
     if success:
+        if cache_dir is not None:
+            _store_cached_build(cache_dir, c_code, output_file)
         print(f"Successfully compiled to: {output_file}")
         if verbose:
             # Show generated C code in verbose mode
@@ -128,6 +242,136 @@ def compile_file(input_file: str, output_file: str = None, emit_c: bool = False,
         return 1
 
 
+def _bench_ops(bench_file: str) -> int:
+    """Read the declared operation count from a benchmark's header.
+
+    Every benchmark carries a `# bench: ops=N` line near the top stating
+    how many operations one run of the program performs; wall time per
+    run divided by N gives ns/op. Keeping the count next to the loop it
+    describes means the harness never has to guess.
+    """
+    import re
+    with open(bench_file, 'r') as f:
+        for line in f.read().splitlines()[:10]:
+            m = re.match(r'#\s*bench:\s*ops=(\d+)', line)
+            if m:
+                return int(m.group(1))
+    return 0
+
+
+def run_bench(bench_dir: str = 'benchmarks', warmup: int = 1, repeat: int = 5,
+              tolerance: float = 1.5, name_filter: str = None,
+              update_baseline: bool = False, verbose: bool = False):
+    """
+    Run the benchmark suite and compare against the committed baseline.
+
+    Each benchmarks/*.nag program is compiled (through the build cache,
+    so unchanged benchmarks cost nothing to rebuild), run `warmup` times
+    untimed, then `repeat` times under a wall-clock timer. The report
+    shows mean ns/op with a 95% confidence interval and the delta
+    against benchmarks/baseline.json; a benchmark whose mean exceeds its
+    baseline by more than `tolerance`x fails the run so regressions
+    surface in CI rather than in the field. --update-baseline rewrites
+    the JSON from the current run.
+
+    Returns:
+        0 on success, 1 if any benchmark regressed or failed to run
+    """
+    import json
+    import math
+    import os
+    import statistics
+    import subprocess
+    import tempfile
+    import time
+
+    bench_files = sorted(Path(bench_dir).glob('*.nag'))
+    if name_filter:
+        bench_files = [f for f in bench_files if name_filter in f.stem]
+    if not bench_files:
+        print(f"No benchmarks found in {bench_dir}/")
+        return 1
+
+    baseline_path = Path(bench_dir) / 'baseline.json'
+    baseline = {}
+    if baseline_path.exists():
+        with open(baseline_path, 'r') as f:
+            baseline = json.load(f)
+
+    results = {}
+    failed = []
+    for bench_file in bench_files:
+        name = bench_file.stem
+        ops = _bench_ops(str(bench_file))
+        if ops <= 0:
+            print(f"{name:<16} skipped (no '# bench: ops=N' header)")
+            continue
+
+        binary = os.path.join(tempfile.gettempdir(), f'nagini_bench_{name}')
+        # The compile phases narrate to stdout; keep the report readable
+        # by swallowing that unless asked for it.
+        if verbose:
+            rc = compile_file(str(bench_file), binary, verbose=True)
+        else:
+            import contextlib
+            import io
+            with contextlib.redirect_stdout(io.StringIO()):
+                rc = compile_file(str(bench_file), binary)
+        if rc != 0:
+            print(f"{name:<16} COMPILE FAILED")
+            failed.append(name)
+            continue
+
+        for _ in range(warmup):
+            subprocess.run([binary], stdout=subprocess.DEVNULL)
+
+        samples = []
+        for _ in range(repeat):
+            start = time.perf_counter_ns()
+            result = subprocess.run([binary], stdout=subprocess.DEVNULL)
+            elapsed = time.perf_counter_ns() - start
+            if result.returncode != 0:
+                print(f"{name:<16} RUN FAILED (exit {result.returncode})")
+                failed.append(name)
+                samples = None
+                break
+            samples.append(elapsed / ops)
+        if samples is None:
+            continue
+
+        mean = statistics.mean(samples)
+        # 95% CI half-width from the t-ish normal approximation; with
+        # repeat=1 there is no spread to estimate, so report 0.
+        ci = 1.96 * statistics.stdev(samples) / math.sqrt(len(samples)) if len(samples) > 1 else 0.0
+        results[name] = mean
+
+        line = f"{name:<16} {mean:10.1f} ns/op  ±{ci:.1f}"
+        base = baseline.get(name)
+        if base is not None:
+            delta = (mean - base) / base * 100.0
+            line += f"  (baseline {base:.1f}, {delta:+.1f}%)"
+            if mean > base * tolerance:
+                line += "  REGRESSION"
+                failed.append(name)
+        else:
+            line += "  (no baseline)"
+        print(line)
+
+    if update_baseline:
+        tmp = str(baseline_path) + f'.{os.getpid()}'
+        with open(tmp, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+            f.write('\n')
+        os.replace(tmp, baseline_path)
+        print(f"Baseline updated: {baseline_path}")
+        return 0
+
+    if failed:
+        print(f"\n{len(failed)} benchmark(s) failed: {', '.join(failed)}")
+        return 1
+    return 0
+
+
 def main():
     """
     Main CLI entry point.
@@ -156,7 +400,24 @@ Examples:
     compile_parser.add_argument('-o', '--output', help='Output file name (default: same as input without extension)')
     compile_parser.add_argument('--emit-c', action='store_true', help='Emit C code instead of compiling to executable')
     compile_parser.add_argument('-v', '--verbose', action='store_true', help='Show detailed compilation information')
-    
+    compile_parser.add_argument('--rt-cache', action='store_true',
+                                help='Link against a cached precompiled runtime library (faster repeated builds)')
+    compile_parser.add_argument('--pgo', action='store_true',
+                                help='Profile-guided optimization: build instrumented, run once as training, rebuild with the profile')
+    compile_parser.add_argument('--no-cache', action='store_true',
+                                help='Bypass the build cache and recompile even if the source is unchanged')
+
+    # ===== Bench Command =====
+    bench_parser = subparsers.add_parser('bench', help='Run the benchmark suite and diff against the baseline')
+    bench_parser.add_argument('--dir', default='benchmarks', help='Directory of benchmark .nag programs (default: benchmarks)')
+    bench_parser.add_argument('--warmup', type=int, default=1, help='Untimed runs before measuring (default: 1)')
+    bench_parser.add_argument('--repeat', type=int, default=5, help='Timed runs per benchmark (default: 5)')
+    bench_parser.add_argument('--tolerance', type=float, default=1.5,
+                              help='Fail when mean ns/op exceeds baseline by this factor (default: 1.5)')
+    bench_parser.add_argument('--filter', help='Only run benchmarks whose name contains this substring')
+    bench_parser.add_argument('--update-baseline', action='store_true',
+                              help='Rewrite the baseline JSON from this run instead of diffing against it')
+
     # Parse command-line arguments
     args = parser.parse_args()
     
@@ -167,8 +428,13 @@ Examples:
     
     # Dispatch to appropriate command handler
     if args.command == 'compile':
-        return compile_file(args.input, args.output, args.emit_c, args.verbose)
-    
+        return compile_file(args.input, args.output, args.emit_c, args.verbose, args.rt_cache, args.pgo,
+                            args.no_cache)
+
+    if args.command == 'bench':
+        return run_bench(args.dir, args.warmup, args.repeat, args.tolerance, args.filter,
+                         args.update_baseline)
+
     return 0
 
 
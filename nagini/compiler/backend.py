@@ -53,14 +53,151 @@ def load_c_from_file(filename: str) -> str:
     with open(c_path, 'r') as f:
         return f.read()
 
+
+def _mask_c_source(source: str) -> str:
+    """Blank out comments and string/char literals, keeping newlines.
+
+    The result lines up byte-for-byte with the input, so brace counting
+    over the masked text gives the real nesting depth of the original.
+    """
+    out = []
+    i = 0
+    n = len(source)
+    state = None  # None | 'line' | 'block' | '"' | "'"
+    while i < n:
+        c = source[i]
+        nxt = source[i + 1] if i + 1 < n else ''
+        if state is None:
+            if c == '/' and nxt == '/':
+                state = 'line'
+                out.append('  ')
+                i += 2
+                continue
+            if c == '/' and nxt == '*':
+                state = 'block'
+                out.append('  ')
+                i += 2
+                continue
+            if c in ('"', "'"):
+                state = c
+                out.append(' ')
+                i += 1
+                continue
+            out.append(c)
+        elif state == 'line':
+            if c == '\n':
+                state = None
+                out.append('\n')
+            else:
+                out.append(' ')
+        elif state == 'block':
+            if c == '*' and nxt == '/':
+                state = None
+                out.append('  ')
+                i += 2
+                continue
+            out.append('\n' if c == '\n' else ' ')
+        else:  # inside a string or char literal
+            if c == '\\' and i + 1 < n:
+                out.append('  ')
+                i += 2
+                continue
+            if c == state:
+                state = None
+            out.append('\n' if c == '\n' else ' ')
+        i += 1
+    return ''.join(out)
+
+
+def runtime_declarations(source: str) -> str:
+    """Reduce a runtime source file to its public interface.
+
+    Used by the separate-compilation mode: preprocessor lines, typedefs,
+    struct/enum definitions and `static` functions are kept verbatim
+    (static helpers have internal linkage, so each translation unit needs
+    its own copy), non-static function definitions are replaced with
+    prototypes and file-scope variables with `extern` declarations. The
+    result compiles against a runtime library built from the full source.
+    """
+    masked = _mask_c_source(source)
+    decls = []
+    i = 0
+    n = len(source)
+    while i < n:
+        # Skip whitespace between top-level chunks
+        while i < n and masked[i] in ' \t\n':
+            decls.append(source[i])
+            i += 1
+        if i >= n:
+            break
+        start = i
+        if masked[i] == '#':
+            # Preprocessor directive, including backslash-continued lines
+            # (multi-line macro definitions)
+            while i < n:
+                while i < n and source[i] != '\n':
+                    i += 1
+                if i > start and source[i - 1] == '\\':
+                    i += 1
+                    continue
+                break
+            decls.append(source[start:i])
+            continue
+        # Collect the chunk: ends at a top-level ';', or at the '}' that
+        # closes a function body (typedef/struct bodies run on to the ';')
+        first_word = masked[i:i + 16].split()[0] if masked[i:i + 16].split() else ''
+        is_aggregate = first_word in ('typedef', 'struct', 'enum', 'union')
+        depth = 0
+        body_start = -1
+        end = n
+        j = i
+        while j < n:
+            c = masked[j]
+            if c == '{':
+                if depth == 0 and body_start < 0:
+                    body_start = j
+                depth += 1
+            elif c == '}':
+                depth -= 1
+                if depth == 0 and not is_aggregate:
+                    end = j + 1
+                    break
+            elif c == ';' and depth == 0:
+                end = j + 1
+                break
+            j += 1
+        chunk = source[start:end]
+        mchunk = masked[start:end]
+        i = end
+        if is_aggregate or first_word == 'static':
+            # Type definition or static helper: keep verbatim
+            decls.append(chunk)
+            continue
+        eq = mchunk.find('=')
+        paren = mchunk.find('(')
+        if eq >= 0 and (paren < 0 or eq < paren):
+            # File-scope variable definition, braced initializer or not
+            decls.append('extern ' + chunk[:eq].rstrip() + ';')
+        elif body_start < 0:
+            # Already a prototype or plain declaration
+            decls.append(chunk)
+        else:
+            # Function definition: signature up to the body, then ';'
+            decls.append(chunk[:body_start - start].rstrip() + ';')
+    return ''.join(decls)
+
 class LLVMBackend:
     """
     C backend for Nagini compiler (LLVM backend planned for future).
     Generates C code and compiles to native machine code using gcc/clang.
     """
     
-    def __init__(self, ir: NaginiIR):
+    def __init__(self, ir: NaginiIR, separate_runtime: bool = False):
         self.ir = ir
+        # When True, the runtime sources are reduced to declarations and
+        # the program links against a cached libnagini_rt.a instead of
+        # recompiling the whole runtime for every .nag file
+        self.separate_runtime = separate_runtime
         self.output_code = []
         self.declared_vars = set()  # Track declared variables
         self.native_vars = {}  # Track native variables: {var_name: native_type}
@@ -69,6 +206,14 @@ class LLVMBackend:
         self._one_const_id: Optional[int] = None
         self.current_class_info: Optional[ClassInfo] = None  # Track current class for native field access
         self.current_method_paradigm: str = 'object'  # Track paradigm for current method
+        # Display name of the function being generated, for the profiler's
+        # call-stack trace; None for main, which is never traced
+        self._trace_display: Optional[str] = None
+        self.func_display_names: dict = {}  # mangled C name -> source name
+        # When True, attribute reads may return borrowed references: the
+        # enclosing statement consumes the value immediately, so no new
+        # reference needs to be taken (and none reconciled later)
+        self._borrow_member_reads = False
         
     def generate(self) -> str:
         """
@@ -120,6 +265,7 @@ class LLVMBackend:
                 if ident is None:
                     ident = gen_uuid(16)
                     fun_ids[func.name] = ident
+                self.func_display_names[f'{func.name}_{ident}'] = func.name
                 func.name = f'{func.name}_{ident}'
             self._gen_function(func)
 
@@ -187,49 +333,78 @@ class LLVMBackend:
         if need_one and self._one_const_id is None:
             self._one_const_id = self._ensure_int_const(1)
     
-    def _gen_headers(self, output_code):
-        """Generate necessary C headers"""
-        output_code.append('#include <stdio.h>')
-        output_code.append('#include <stdlib.h>')
-        output_code.append('#include <stdint.h>')
-        output_code.append('#include <string.h>')
-        output_code.append('#include <stdbool.h>')
-        output_code.append('#include <math.h>')
-        output_code.append('#include <assert.h>')
-        output_code.append('#include <limits.h>')
+    @staticmethod
+    def _runtime_prelude():
+        """System includes and forward declarations shared by the program
+        translation unit and the runtime library translation unit."""
+        lines = []
+        lines.append('#include <stdio.h>')
+        lines.append('#include <stdlib.h>')
+        lines.append('#include <stdint.h>')
+        lines.append('#include <string.h>')
+        lines.append('#include <stdbool.h>')
+        lines.append('#include <math.h>')
+        lines.append('#include <assert.h>')
+        lines.append('#include <limits.h>')
         if sys.platform == 'win32':
-            output_code.append('#include <windows.h>')
-            output_code.append('#include <bcrypt.h>')
+            lines.append('#include <windows.h>')
+            lines.append('#include <bcrypt.h>')
         elif sys.platform == 'linux':
-            output_code.append('#include <unistd.h>')
-            output_code.append('#include <sys/random.h>')
+            lines.append('#include <unistd.h>')
+            lines.append('#include <pthread.h>')
+            lines.append('#include <sys/random.h>')
+            lines.append('#include <sys/mman.h>')
+            lines.append('#include <sys/stat.h>')
+            lines.append('#include <fcntl.h>')
+            lines.append('#include <signal.h>')
+            lines.append('#include <sys/time.h>')
+            lines.append('#include <execinfo.h>')
+        lines.append('')
+        lines.append('/* Forward declarations */')
+        lines.append('typedef struct HashTable HashTable;')
+        lines.append('typedef struct Object Object;')
+        lines.append('typedef struct InstanceObject InstanceObject;')
+        lines.append('typedef struct StringObject StringObject;')
+        lines.append('typedef struct DynamicPool DynamicPool;')
+        lines.append('typedef struct StaticPool StaticPool;')
+        lines.append('typedef struct Dict Dict;')
+        lines.append('typedef struct Runtime Runtime;')
+        lines.append('typedef struct Function Function;')
+        lines.append('typedef struct Set Set;')
+        lines.append('typedef struct Tuple Tuple;')
+        lines.append('')
+        return lines
+
+    def _gen_headers(self, output_code):
+        """Generate necessary C headers"""
+        prelude = self._runtime_prelude()
+        # CONST_COUNT belongs to the program, not the runtime: the runtime
+        # table is sized at init_runtime(CONST_COUNT) so the same compiled
+        # runtime serves every program
+        output_code.extend(prelude[:prelude.index('')])
         output_code.append('')
         output_code.append('/* Nagini Constants */')
         output_code.append(f'#define CONST_COUNT {self.ir.const_count}')
         output_code.append('')
-        output_code.append('/* Forward declarations */')
-        output_code.append('typedef struct HashTable HashTable;')
-        output_code.append('typedef struct Object Object;')
-        output_code.append('typedef struct InstanceObject InstanceObject;')
-        output_code.append('typedef struct StringObject StringObject;')
-        output_code.append('typedef struct DynamicPool DynamicPool;')
-        output_code.append('typedef struct StaticPool StaticPool;')
-        output_code.append('typedef struct Dict Dict;')
-        output_code.append('typedef struct Runtime Runtime;')
-        output_code.append('typedef struct Function Function;')
-        output_code.append('typedef struct Set Set;')
-        output_code.append('typedef struct Tuple Tuple;')
-        output_code.append('')
-    
+        output_code.extend(prelude[prelude.index('') + 1:])
+
+    def _runtime_source_file(self, filename: str) -> str:
+        """Paste a runtime source file, or just its interface when the
+        program links against the precompiled runtime library."""
+        source = load_c_from_file(filename)
+        if self.separate_runtime:
+            return runtime_declarations(source)
+        return source
+
     def _gen_pools(self):
-        self.output_code.append(load_c_from_file('pool.h'))
-    
+        self.output_code.append(self._runtime_source_file('pool.h'))
+
     def _gen_hmap(self):
         """Generate hash table implementation for Object members"""
-        self.output_code.append(load_c_from_file('hmap.h'))
-    
+        self.output_code.append(self._runtime_source_file('hmap.h'))
+
     def _gen_base_object(self):
-        self.output_code.append(load_c_from_file('builtin.h'))
+        self.output_code.append(self._runtime_source_file('builtin.h'))
     
     def _gen_symbol_table(self):
         pass
@@ -257,12 +432,14 @@ class LLVMBackend:
         self.output_code.append('    if (expected_type == NULL) return;  /* Untyped parameter */')
         self.output_code.append('    if (obj == NULL) {')
         self.output_code.append('        fprintf(stderr, "Runtime Error: Parameter \'%s\' is NULL but expected type \'%s\'\\n", param_name, expected_type);')
+        self.output_code.append('        ng_print_traceback();')
         self.output_code.append('        exit(1);')
         self.output_code.append('    }')
         self.output_code.append('    /* Get type name from symbol table using typename ID */')
         self.output_code.append('    char* actual_type = (char*)hmap_get(runtime->symbol_table, obj->__typename__);')
         self.output_code.append('    if (actual_type != NULL && strcmp(actual_type, expected_type) != 0) {')
         self.output_code.append('        fprintf(stderr, "Runtime Error: Parameter \'%s\' has type \'%s\' but expected \'%s\'\\n", param_name, actual_type, expected_type);')
+        self.output_code.append('        ng_print_traceback();')
         self.output_code.append('        exit(1);')
         self.output_code.append('    }')
         self.output_code.append('}')
@@ -273,9 +450,11 @@ class LLVMBackend:
         self.output_code.append('void check_arg_count(Runtime* runtime, const char* func_name, int64_t expected, int64_t actual, uint8_t has_varargs) {')
         self.output_code.append('    if (!has_varargs && actual != expected) {')
         self.output_code.append('        fprintf(stderr, "Runtime Error: Function \'%s\' expects %ld arguments but got %ld\\n", func_name, expected, actual);')
+        self.output_code.append('        ng_print_traceback();')
         self.output_code.append('        exit(1);')
         self.output_code.append('    } else if (has_varargs && actual < expected) {')
         self.output_code.append('        fprintf(stderr, "Runtime Error: Function \'%s\' expects at least %ld arguments but got %ld\\n", func_name, expected, actual);')
+        self.output_code.append('        ng_print_traceback();')
         self.output_code.append('        exit(1);')
         self.output_code.append('    }')
         self.output_code.append('}')
@@ -310,10 +489,30 @@ class LLVMBackend:
                         args += f', {param_name}'
                         prms += f', Object* {param_name}'
 
+            has_slots = bool(class_info.fields)
+
             self.output_code.append(f'Object* NgAlloc{class_info.name}(Runtime* runtime, Tuple* args, Dict* kwargs) {{')
             self.output_code.append(f'    /* Allocate instance of {class_info.name} */')
-                
-            self.output_code.append(f'    Object* self = alloc_instance(runtime);')
+
+            if has_slots:
+                # Fields are statically known: lay them out as Object* slots
+                # directly after the InstanceObject header. The layout is
+                # registered in def_class_{name} so member access routes
+                # declared attributes to fixed offsets.
+                slot_count = len(class_info.fields)
+                self.output_code.append(f'    bool is_manual = false;')
+                self.output_code.append(f'    int pool_id = 0;')
+                self.output_code.append(f'    InstanceObject* self_inst = (InstanceObject*) alloc(runtime, sizeof(InstanceObject) + {slot_count} * sizeof(Object*), &is_manual, &pool_id, true);')
+                self.output_code.append(f'    self_inst->base.__flags__.type = OBJ_TYPE_INSTANCE;')
+                self.output_code.append(f'    self_inst->base.__allocation__.is_manual = is_manual ? 1 : 0;')
+                self.output_code.append(f'    self_inst->base.__allocation__.pool_id = pool_id;')
+                self.output_code.append(f'    self_inst->base.__refcount__ = 1;')
+                self.output_code.append(f'    self_inst->base.__typename__ = get_symbol_id(runtime, "{class_info.name}");')
+                self.output_code.append(f'    self_inst->__dict__ = alloc_dict(runtime);')
+                self.output_code.append(f'    ng_gc_track(runtime, (Object*) self_inst);')
+                self.output_code.append(f'    Object* self = (Object*) self_inst;')
+            else:
+                self.output_code.append(f'    Object* self = alloc_instance(runtime);')
             self.output_code.append(f'    args = (Tuple*) NgPrependTuple(runtime, self, args);')
             self.output_code.append(f'    {class_info.name}___init__(runtime, args, kwargs);')
             self.output_code.append(f'    /* Set class */')
@@ -362,6 +561,13 @@ class LLVMBackend:
                     self.output_code.append(f'    {{')
                     self.output_code.append(f'        NgSetMember(runtime, cls, runtime->constants[{field.name_id}], runtime->constants[{field.func_id}]);')
                     self.output_code.append(f'    }}')
+            if has_slots:
+                name_consts = ', '.join(
+                    f'runtime->constants[{self.ir.register_string_constant(field.name)}]'
+                    for field in class_info.fields
+                )
+                self.output_code.append(f'    /* Register fixed slot layout for declared fields */')
+                self.output_code.append(f'    ng_register_slot_layout(runtime, "{class_info.name}", {len(class_info.fields)}, (Object*[]) {{{name_consts}}});')
             self.output_code.append(f'    return cls;')
             self.output_code.append(f'}}')
         elif class_info.paradigm == 'native':
@@ -415,6 +621,7 @@ class LLVMBackend:
         self.output_code.append(f'    {class_info.name}* instance = ({class_info.name}*) alloc(runtime, sizeof({class_info.name}), &is_manual, &pool_id, true);')
         self.output_code.append(f'    if (!instance) {{')
         self.output_code.append(f'        fprintf(stderr, "Runtime Error: Failed to allocate memory for {class_info.name}\\n");')
+        self.output_code.append(f'        ng_print_traceback();')
         self.output_code.append(f'        exit(1);')
         self.output_code.append(f'    }}')
         self.output_code.append(f'    /* Initialize InstanceObject header */')
@@ -521,11 +728,13 @@ class LLVMBackend:
         # self.output_code.append(f'/* Types: {", ".join(param_types)} */')
         # Method name is ClassName_methodname
         method_name = f'{class_info.name}_{method_ir.name}'
+        self.func_display_names[method_name] = f'{class_info.name}.{method_ir.name}'
         
         self.output_code.append(f'/* Method: {class_info.name}.{method_ir.name} */')
         self.output_code.append(f'{return_type} {method_name}(Runtime* runtime, Tuple* args, Dict* kwargs) {{')
         self.output_code.append(f'    if (args->size < {len(method_ir.params)}) {{')
         self.output_code.append(f'        fprintf(stderr, "Runtime Error: Method \'{class_info.name}.{method_ir.name}\' expects at least {len(method_ir.params)} arguments but got %zu\\n", args->size);')
+        self.output_code.append(f'        ng_print_traceback();')
         self.output_code.append(f'        exit(1);')
         self.output_code.append(f'    }}')
         self.output_code.append('')
@@ -549,6 +758,7 @@ class LLVMBackend:
                     self.output_code.append(f'    NgGetTypeName(runtime, {obj_var_name}, pName_{param_name}, sizeof(pName_{param_name}));')
                     self.output_code.append(f'    if (strcmp("{param_type}", pName_{param_name}) != 0) {{')
                     self.output_code.append(f'        fprintf(stderr, "Runtime Error: Received wrong type for parameter \'{param_name}\' in method \'{class_info.name}.{method_ir.name}\'.\\n Expected type: {param_type}, got: %s\\n", pName_{param_name});')
+                    self.output_code.append(f'        ng_print_traceback();')
                     self.output_code.append(f'        exit(1);')
                     self.output_code.append(f'    }}')
             else:
@@ -559,6 +769,7 @@ class LLVMBackend:
                     self.output_code.append(f'    NgGetTypeName(runtime, {param_name}, pName_{param_name}, sizeof(pName_{param_name}));')
                     self.output_code.append(f'    if (strcmp("{param_type}", pName_{param_name}) != 0) {{')
                     self.output_code.append(f'        fprintf(stderr, "Runtime Error: Received wrong type for parameter \'{param_name}\' in method \'{class_info.name}.{method_ir.name}\'.\\n Expected type: {param_type}, got: %s\\n", pName_{param_name});')
+                    self.output_code.append(f'        ng_print_traceback();')
                     self.output_code.append(f'        exit(1);')
                     self.output_code.append(f'    }}')
             
@@ -583,7 +794,10 @@ class LLVMBackend:
                         self.native_vars[param_name] = 'bool'
         
         # Verify hmap_get(self.hmap, symbol_id) against expected types for strict parameters (symbol_id should be of '__typename__' convention)
-            
+
+        self._trace_display = f'{class_info.name}.{method_ir.name}'
+        self.output_code.append(f'    if (runtime->profile.active) ng_trace_push(runtime, "{self._trace_display}");')
+
         # Generate method body
         for stmt in method_ir.body:
             stmt_code = self._gen_stmt(stmt, indent=1)
@@ -592,11 +806,13 @@ class LLVMBackend:
         # check if return statement is present
         has_return = any(isinstance(stmt, ReturnIR) for stmt in method_ir.body)
         if not has_return:
+            self.output_code.append('    if (runtime->profile.active) ng_trace_pop(runtime);')
             self.output_code.append('    return NULL;')
-        
+
         # Clear current class info
         self.current_class_info = None
         self.current_method_paradigm = 'object'
+        self._trace_display = None
         
         self.output_code.append('}')
         self.output_code.append('')
@@ -621,8 +837,10 @@ class LLVMBackend:
         if func.name == 'main':
             return_type = 'int'
             declared_vars = set()
+            self._trace_display = None
         else:
             return_type = 'Object*'
+            self._trace_display = self.func_display_names.get(func.name, func.name)
         
         # Build parameter list
         params_str = 'Runtime* runtime, Tuple* args, Dict* kwargs' if not func.name == 'main' else 'void'
@@ -630,6 +848,7 @@ class LLVMBackend:
         if not func.name == 'main':
             self.output_code.append(f'    if (args->size < {len(func.params)}) {{')
             self.output_code.append(f'        fprintf(stderr, "Runtime Error: Function \'{func.name}\' expects at least {len(func.params)} arguments but got %zu\\n", args->size);')
+            self.output_code.append(f'        ng_print_traceback();')
             self.output_code.append(f'        exit(1);')
             self.output_code.append(f'    }}')
         for param_name, _ in func.params:
@@ -640,6 +859,7 @@ class LLVMBackend:
                 self.output_code.append(f'    NgGetTypeName(runtime, {param_name}, pName_{param_name}, sizeof(pName_{param_name}));')
                 self.output_code.append(f'    if (strcmp("{_}", pName_{param_name}) != 0) {{')
                 self.output_code.append(f'        fprintf(stderr, "Runtime Error: Received wrong type for parameter \'{param_name}\' in function \'{func.name}\'.\\n Expected type: {_}, got: %s\\n", pName_{param_name});')
+                self.output_code.append(f'        ng_print_traceback();')
                 self.output_code.append(f'        exit(1);')
                 self.output_code.append(f'    }}')
         
@@ -653,10 +873,13 @@ class LLVMBackend:
                         self.output_code.append(f'    /* Runtime type check for strict parameter: {param_name} */')
                         self.output_code.append(f'    check_param_type("{param_name}", {param_name}, "{param_type}");')
         
+        if self._trace_display:
+            self.output_code.append(f'    if (runtime->profile.active) ng_trace_push(runtime, "{self._trace_display}");')
+
         # Init main function body
         if func.name == 'main':
             self.output_code.append('    /* Runtime and Symbol table */')
-            self.output_code.append('    Runtime* runtime = init_runtime();')
+            self.output_code.append('    Runtime* runtime = init_runtime(CONST_COUNT);')
             self.output_code.append('')
             self.output_code.append('    /*')
             self.output_code.append(f'    total constants: {self.ir.const_count}')
@@ -669,8 +892,26 @@ class LLVMBackend:
                     self.output_code.append(f'    runtime->constants[{k}] = alloc_function(runtime, "{v.name}", {v.line_no}, {len(v.params)}, (void*)&{v.full_name});')
                 else:
                     a, b = v
+                    if b == 'alloc_str':
+                        # String constants are interned so identifier lookups
+                        # (attributes, dict keys) hit pointer equality
+                        b = 'alloc_str_interned'
                     self.output_code.append(f'    runtime->constants[{k}] = {b}(runtime, {a});')
             self.output_code.append('')
+            self.output_code.append('    /* Constants are program-lifetime: immortalize them so refcounts')
+            self.output_code.append('       never touch them and spawn() shards can share the table */')
+            self.output_code.append('    ng_immortalize_constants(runtime);')
+            self.output_code.append('')
+            if self.func_display_names:
+                # Address table for lazy traceback reconstruction: one entry
+                # per generated function, sorted at registration
+                self.output_code.append('    static NgFuncInfo __ng_functions[] = {')
+                for c_name, display in self.func_display_names.items():
+                    self.output_code.append(f'        {{ (void*)&{c_name}, "{display}" }},')
+                self.output_code.append('        { (void*)&main, "main" },')
+                self.output_code.append('    };')
+                self.output_code.append(f'    ng_register_functions(__ng_functions, {len(self.func_display_names) + 1});')
+                self.output_code.append('')
 
         # Generate function body
         for stmt in func.body:
@@ -685,10 +926,13 @@ class LLVMBackend:
             self.output_code.append('    return 0;')
         elif not has_return:
             if return_type == 'Object*':
+                if self._trace_display:
+                    self.output_code.append('    if (runtime->profile.active) ng_trace_pop(runtime);')
                 self.output_code.append('    return NULL;')
-        
+
         self.output_code.append('}')
         self.output_code.append('')
+        self._trace_display = None
     
     def _gen_stmt(self, stmt: StmtIR, indent: int = 0) -> list:
         """Generate C code for a statement IR node"""
@@ -767,20 +1011,30 @@ class LLVMBackend:
             # Return statement
             if stmt.value:
                 expr_code = self._gen_expr(stmt.value)
-                result.append(f'{ind}return {expr_code};')
+                if self._trace_display:
+                    # Evaluate the result before unwinding the trace entry
+                    result.append(f'{ind}{{')
+                    result.append(f'{ind}    Object* __ret = {expr_code};')
+                    result.append(f'{ind}    if (runtime->profile.active) ng_trace_pop(runtime);')
+                    result.append(f'{ind}    return __ret;')
+                    result.append(f'{ind}}}')
+                else:
+                    result.append(f'{ind}return {expr_code};')
             else:
+                if self._trace_display:
+                    result.append(f'{ind}if (runtime->profile.active) ng_trace_pop(runtime);')
                 result.append(f'{ind}return;')
         
         elif isinstance(stmt, IfIR):
             # If statement
-            cond_code = self._gen_expr(stmt.condition)
+            cond_code = self._gen_temp_expr(stmt.condition)
             result.append(f'{ind}if ({cond_code}) {{')
             for body_stmt in stmt.then_body:
                 result.extend(self._gen_stmt(body_stmt, indent + 1))
-            
+
             # Handle elif
             for elif_cond, elif_body in stmt.elif_parts:
-                result.append(f'{ind}}} else if ({self._gen_expr(elif_cond)}) {{')
+                result.append(f'{ind}}} else if ({self._gen_temp_expr(elif_cond)}) {{')
                 for body_stmt in elif_body:
                     result.extend(self._gen_stmt(body_stmt, indent + 1))
             
@@ -794,7 +1048,7 @@ class LLVMBackend:
         
         elif isinstance(stmt, WhileIR):
             # While loop
-            cond_expr = self._gen_expr(stmt.condition)
+            cond_expr = self._gen_temp_expr(stmt.condition)
             cond_code = f'NgCastToInt(runtime, {cond_expr})'
             result.append(f'{ind}while ({cond_code}) {{')
             for body_stmt in stmt.body:
@@ -840,8 +1094,7 @@ class LLVMBackend:
                 result.append(f'{ind}    int64_t __step{temp_id} = {step_code};')
                 result.append(f'{ind}    if (__step{temp_id} == 0) {{ fprintf(stderr, "Runtime Error: range() step argument must not be zero.\\n"); exit(1); }}')
                 result.append(f'{ind}    for (int64_t __i{temp_id} = __start{temp_id}; (__step{temp_id} > 0) ? (__i{temp_id} < __end{temp_id}) : (__i{temp_id} > __end{temp_id}); __i{temp_id} += __step{temp_id}) {{')
-                result.append(f'{ind}        if ({stmt.target}) DECREF(runtime, {stmt.target});')
-                result.append(f'{ind}        {stmt.target} = alloc_int(runtime, __i{temp_id});')
+                result.append(f'{ind}        {stmt.target} = ng_int_reuse(runtime, {stmt.target}, __i{temp_id});')
 
                 for body_stmt in stmt.body:
                     result.extend(self._gen_stmt(body_stmt, indent + 2))
@@ -849,28 +1102,58 @@ class LLVMBackend:
                 result.append(f'{ind}    }}')
                 result.append(f'{ind}}}')
             else:
-                iter_code = self._gen_expr(stmt.iter_expr)
+                iter_code = self._gen_temp_expr(stmt.iter_expr)
                 if stmt.target not in self.declared_vars:
                     result.append(f'{ind}Object* {stmt.target} = NULL;')
                     self.declared_vars.add(stmt.target)
                 temp_id = gen_uuid(16)
+                # Lists iterate by direct index (unboxed elements are boxed
+                # the same way NgIterNext would, boxed elements are fetched
+                # with a reference taken: the body may store over or pop the
+                # slot being iterated, which would free a borrowed element
+                # out from under the loop); anything else falls back to the
+                # iterator protocol. A single loop body serves both shapes,
+                # so the per-iteration cost is one predictable branch
+                # instead of an NgIterator allocation plus a call.
                 result.append(f'{ind}{{')
-                result.append(f'{ind}    Object* __iter_{temp_id} = NgIter(runtime, {iter_code});')
+                result.append(f'{ind}    Object* __seq_{temp_id} = (Object*)({iter_code});')
+                # The sequence may come from a borrowed read (e.g. a cached
+                # member access); hold a reference for the whole loop so a
+                # body that rebinds the attribute cannot free it mid-iteration
+                result.append(f'{ind}    INCREF(runtime, __seq_{temp_id});')
+                result.append(f'{ind}    List* __list_{temp_id} = (__seq_{temp_id} && __seq_{temp_id}->__flags__.type == OBJ_TYPE_LIST) ? (List*)__seq_{temp_id} : NULL;')
+                result.append(f'{ind}    Object* __iter_{temp_id} = __list_{temp_id} ? NULL : NgIter(runtime, __seq_{temp_id});')
+                result.append(f'{ind}    size_t __idx_{temp_id} = 0;')
                 result.append(f'{ind}    while (1) {{')
-                result.append(f'{ind}        Object* __next_{temp_id} = NgIterNext(runtime, __iter_{temp_id});')
-                result.append(f'{ind}        if (!__next_{temp_id}) break;')
-                result.append(f'{ind}        if ({stmt.target}) DECREF(runtime, {stmt.target});')
-                result.append(f'{ind}        {stmt.target} = __next_{temp_id};')
+                result.append(f'{ind}        if (__list_{temp_id}) {{')
+                result.append(f'{ind}            if (__idx_{temp_id} >= __list_{temp_id}->size) break;')
+                result.append(f'{ind}            if (__list_{temp_id}->store == LIST_STORE_I64) {{')
+                result.append(f'{ind}                {stmt.target} = ng_int_reuse(runtime, {stmt.target}, ((int64_t*)__list_{temp_id}->items)[__idx_{temp_id}]);')
+                result.append(f'{ind}            }} else if (__list_{temp_id}->store == LIST_STORE_F64) {{')
+                result.append(f'{ind}                if ({stmt.target}) DECREF(runtime, {stmt.target});')
+                result.append(f'{ind}                {stmt.target} = alloc_float(runtime, ((double*)__list_{temp_id}->items)[__idx_{temp_id}]);')
+                result.append(f'{ind}            }} else {{')
+                result.append(f'{ind}                if ({stmt.target}) DECREF(runtime, {stmt.target});')
+                result.append(f'{ind}                {stmt.target} = (Object*) INCREF(runtime, __list_{temp_id}->items[__idx_{temp_id}]);')
+                result.append(f'{ind}            }}')
+                result.append(f'{ind}            __idx_{temp_id}++;')
+                result.append(f'{ind}        }} else {{')
+                result.append(f'{ind}            Object* __next_{temp_id} = NgIterNext(runtime, __iter_{temp_id});')
+                result.append(f'{ind}            if (!__next_{temp_id}) break;')
+                result.append(f'{ind}            if ({stmt.target}) DECREF(runtime, {stmt.target});')
+                result.append(f'{ind}            {stmt.target} = __next_{temp_id};')
+                result.append(f'{ind}        }}')
                 for body_stmt in stmt.body:
                     result.extend(self._gen_stmt(body_stmt, indent + 2))
                 result.append(f'{ind}    }}')
                 result.append(f'{ind}    if ({stmt.target}) {{ DECREF(runtime, {stmt.target}); {stmt.target} = NULL; }}')
                 result.append(f'{ind}    if (__iter_{temp_id}) DECREF(runtime, __iter_{temp_id});')
+                result.append(f'{ind}    if (__seq_{temp_id}) DECREF(runtime, __seq_{temp_id});')
                 result.append(f'{ind}}}')
         
         elif isinstance(stmt, ExprStmtIR):
             # Expression statement (e.g., function call)
-            expr_code = self._gen_expr(stmt.expr)
+            expr_code = self._gen_temp_expr(stmt.expr)
             result.append(f'{ind}{expr_code};')
         
         elif isinstance(stmt, WithIR):
@@ -904,11 +1187,33 @@ class LLVMBackend:
                 # Will need to get actual string value from constants
                 pass
         
+        # Optional thread count for parallel_range loops: nexc('cpu', threads=N)
+        self._nexc_threads = None
+        if (isinstance(stmt.context_expr, CallIR) and stmt.context_expr.kwargs
+                and 'threads' in stmt.context_expr.kwargs):
+            threads_expr = stmt.context_expr.kwargs['threads']
+            if isinstance(threads_expr, ConstantIR) and threads_expr.type_name == 'int':
+                const_id = threads_expr.value
+                if const_id in self.ir.consts:
+                    self._nexc_threads = str(self.ir.consts[const_id][0])
+
+        # optim.persist(arr) hands a native array to Nagini code as a
+        # buffer object, so the buffer variable has to outlive the block
+        # and the persisted arrays must live on the heap instead of the
+        # C stack. Both are decided up front with a prescan of the body.
+        buf_names, self._nexc_persist_arrays = self._collect_nexc_persist(stmt.body, stmt.target)
+        for buf_name in buf_names:
+            if buf_name not in self.declared_vars:
+                result.append(f'{ind}Object* {buf_name} = NULL;')
+                self.declared_vars.add(buf_name)
+
         result.append(f'{ind}{{')
         result.append(f'{ind}    /* Native Execution Context (nexc) - {target_platform} target */')
-        
+
         # Track native arrays and their types for this nexc block
         nexc_arrays = {}
+        # Native record types declared with optim.struct() in this block
+        self._nexc_structs = {}
         
         # Process the body to find array allocations and generate native code
         for body_stmt in stmt.body:
@@ -916,7 +1221,113 @@ class LLVMBackend:
         
         result.append(f'{ind}}}')
         return result
-    
+
+    def _collect_nexc_persist(self, body: list, context_var: str):
+        """Prescan a nexc body for `buf = optim.persist(arr)` assignments.
+
+        Returns the buffer variable names (declared ahead of the block
+        braces so they survive it) and the set of persisted array names
+        (allocated with malloc instead of on the C stack so the handoff
+        to the buffer object is zero-copy).
+        """
+        buf_names = []
+        persist_arrays = set()
+
+        def walk(stmts):
+            for s in stmts:
+                if isinstance(s, AssignIR) and isinstance(s.value, CallIR):
+                    call = s.value
+                    if (isinstance(call.obj, VariableIR) and call.obj.name == context_var
+                            and call.func_name == 'persist' and call.args
+                            and isinstance(call.args[0], VariableIR)):
+                        buf_names.append(s.target)
+                        persist_arrays.add(call.args[0].name)
+                elif isinstance(s, (ForIR, WhileIR)):
+                    walk(s.body)
+                elif isinstance(s, IfIR):
+                    walk(s.then_body)
+                    if s.else_body:
+                        walk(s.else_body)
+                elif isinstance(s, MultiAssignIR):
+                    walk(s.assignments)
+
+        walk(body)
+        return buf_names, persist_arrays
+
+    def _nexc_simd_clause(self, stmt: ForIR, nexc_arrays: dict, context_var: str = 'optim'):
+        """Decide whether a nexc range() loop can carry `#pragma omp simd`.
+
+        Returns the clause suffix for the pragma ('' for a plain loop,
+        ' reduction(op:var)' for accumulator loops) or None when the loop
+        must stay scalar. The check is deliberately conservative: every
+        subscript in the body has to be indexed by the loop variable itself
+        (so iterations cannot alias each other) and scalar updates have to
+        be either loop-private temporaries or recognizable reductions.
+        """
+        loop_var = stmt.target
+
+        def indexes_ok(expr) -> bool:
+            if isinstance(expr, SubscriptIR):
+                if not (isinstance(expr.index, VariableIR) and expr.index.name == loop_var):
+                    return False
+                return indexes_ok(expr.obj)
+            if isinstance(expr, BinOpIR):
+                return indexes_ok(expr.left) and indexes_ok(expr.right)
+            if isinstance(expr, UnaryOpIR):
+                return indexes_ok(expr.operand)
+            if isinstance(expr, (VariableIR, ConstantIR)):
+                return True
+            if isinstance(expr, AttributeIR):
+                # Record field read (pts[i].x): safe whenever the element
+                # subscript is, for both AoS and SoA lowerings
+                return indexes_ok(expr.obj)
+            if (isinstance(expr, CallIR) and isinstance(expr.obj, VariableIR)
+                    and expr.obj.name == context_var and expr.func_name == 'cast'):
+                # optim.cast(type, value): args[0] is the type attribute
+                return all(indexes_ok(a) for a in expr.args[1:])
+            return False
+
+        reductions = []
+        for body_stmt in stmt.body:
+            if isinstance(body_stmt, SubscriptAssignIR):
+                if not (indexes_ok(body_stmt.obj) and indexes_ok(body_stmt.value)
+                        and isinstance(body_stmt.index, VariableIR)
+                        and body_stmt.index.name == loop_var):
+                    return None
+                continue
+            if isinstance(body_stmt, AssignIR):
+                target = body_stmt.target
+                if not indexes_ok(body_stmt.value):
+                    return None
+                if target not in nexc_arrays:
+                    # Declared inside the loop body: private per iteration
+                    continue
+                info = nexc_arrays[target]
+                if info.get('size') == 1 and isinstance(body_stmt.value, BinOpIR):
+                    value = body_stmt.value
+                    self_update = (
+                        (isinstance(value.left, VariableIR) and value.left.name == target) or
+                        (isinstance(value.right, VariableIR) and value.right.name == target)
+                    )
+                    if self_update and value.op in ('+', '-', '*'):
+                        reductions.append(f'{value.op}:{target}')
+                        continue
+                return None
+            if isinstance(body_stmt, SetAttrIR):
+                # Record field store (pts[i].x = ...): same aliasing rule
+                # as a subscript store
+                if (isinstance(body_stmt.obj, SubscriptIR)
+                        and indexes_ok(body_stmt.obj)
+                        and indexes_ok(body_stmt.value)):
+                    continue
+                return None
+            # Control flow or anything else: leave the loop scalar
+            return None
+
+        if reductions:
+            return ' reduction(' + ') reduction('.join(reductions) + ')'
+        return ''
+
     def _gen_nexc_stmt(self, stmt: StmtIR, indent: int, nexc_arrays: dict, context_var: str) -> list:
         """Generate native C code for statements inside nexc block"""
         ind = '    ' * indent
@@ -959,22 +1370,126 @@ class LLVMBackend:
                                 # Fallback to default for now
                                 array_type = 'double'
                         
+                        if stmt.target in getattr(self, '_nexc_persist_arrays', set()):
+                            # Persisted arrays live on the heap so that
+                            # optim.persist() can hand the storage to a
+                            # buffer object without copying it
+                            result.append(f'{ind}{array_type}* {stmt.target} = ({array_type}*) malloc(sizeof({array_type}) * ({size_code}));')
+                            if method_name == 'zeros':
+                                result.append(f'{ind}memset({stmt.target}, 0, sizeof({array_type}) * ({size_code}));')
+                            elif method_name == 'ones':
+                                init_val = '1.0' if 'double' in array_type or 'float' in array_type else '1'
+                                result.append(f'{ind}for(int __i_{stmt.target} = 0; __i_{stmt.target} < {size_code}; __i_{stmt.target}++) {{')
+                                result.append(f'{ind}    {stmt.target}[__i_{stmt.target}] = {init_val};')
+                                result.append(f'{ind}}}')
+                            nexc_arrays[stmt.target] = {'type': array_type, 'size': size_code}
+                            return result
+
                         # Generate native C array
+                        # 32-byte alignment so vectorized loops over the
+                        # array can use aligned SIMD loads/stores
                         init_value = ''
                         if method_name == 'zeros':
                             init_value = ' = {0}'
                         elif method_name == 'ones':
-                            result.append(f'{ind}{array_type} {stmt.target}[{size_code}];')
+                            result.append(f'{ind}{array_type} {stmt.target}[{size_code}] __attribute__((aligned(32)));')
                             result.append(f'{ind}for(int __i_{stmt.target} = 0; __i_{stmt.target} < {size_code}; __i_{stmt.target}++) {{')
                             init_val = '1.0' if 'double' in array_type or 'float' in array_type else '1'
                             result.append(f'{ind}    {stmt.target}[__i_{stmt.target}] = {init_val};')
                             result.append(f'{ind}}}')
                             nexc_arrays[stmt.target] = {'type': array_type, 'size': size_code}
                             return result
-                        
-                        result.append(f'{ind}{array_type} {stmt.target}[{size_code}]{init_value};')
+
+                        result.append(f'{ind}{array_type} {stmt.target}[{size_code}] __attribute__((aligned(32))){init_value};')
                         nexc_arrays[stmt.target] = {'type': array_type, 'size': size_code}
                         return result
+
+                    elif method_name == 'struct':
+                        # Point = optim.struct(x=optim.fp32, ...): declare a
+                        # native record type. Storage comes from optim.list().
+                        fields = {}
+                        for field_name, type_expr in (call.kwargs or {}).items():
+                            c_type = 'double'
+                            if isinstance(type_expr, AttributeIR):
+                                type_name = self._get_type_name_from_attr(type_expr)
+                                c_type = self._map_nexc_type_to_c(type_name)
+                            fields[field_name] = c_type
+                        if not fields:
+                            raise ValueError(f"{context_var}.struct() needs at least one field")
+                        self._nexc_structs[stmt.target] = fields
+                        field_decls = ' '.join(f'{t} {n};' for n, t in fields.items())
+                        result.append(f'{ind}typedef struct {{ {field_decls} }} {stmt.target};')
+                        return result
+
+                    elif method_name == 'list':
+                        # pts = optim.list(n, type=Point[, layout='soa']):
+                        # native record array. The default AoS layout is one
+                        # C struct per element for random access; layout='soa'
+                        # emits one contiguous array per field instead, so a
+                        # sweep that touches a single field stays cache-dense
+                        # and vectorizable. Element access (pts[i].x) compiles
+                        # to the matching form either way.
+                        size_expr = call.args[0] if call.args else ConstantIR(0, 'int')
+                        size_code = self._gen_nexc_expr(size_expr, nexc_arrays)
+                        type_name = None
+                        if call.kwargs and 'type' in call.kwargs and isinstance(call.kwargs['type'], VariableIR):
+                            type_name = call.kwargs['type'].name
+                        if type_name not in self._nexc_structs:
+                            raise ValueError(f"{context_var}.list() expects type= an {context_var}.struct() type")
+                        fields = self._nexc_structs[type_name]
+                        layout = 'aos'
+                        if call.kwargs and 'layout' in call.kwargs:
+                            layout_expr = call.kwargs['layout']
+                            if isinstance(layout_expr, ConstantIR) and layout_expr.value in self.ir.consts:
+                                layout = str(self.ir.consts[layout_expr.value][0]).strip('"')
+                        persisted = stmt.target in getattr(self, '_nexc_persist_arrays', set())
+                        if layout == 'soa':
+                            # SoA storage is one array per field; there is no
+                            # single allocation a buffer object could own
+                            if persisted:
+                                raise ValueError(f"{context_var}.persist() cannot persist a layout='soa' list; use the default AoS layout")
+                            for field_name, c_type in fields.items():
+                                result.append(f'{ind}{c_type} {stmt.target}_{field_name}[{size_code}] __attribute__((aligned(32)));')
+                        elif persisted:
+                            # Persisted record arrays live on the heap so that
+                            # optim.persist() can hand the storage to a buffer
+                            # object without copying it
+                            result.append(f'{ind}{type_name}* {stmt.target} = ({type_name}*) malloc(sizeof({type_name}) * ({size_code}));')
+                        else:
+                            result.append(f'{ind}{type_name} {stmt.target}[{size_code}] __attribute__((aligned(32)));')
+                        nexc_arrays[stmt.target] = {'type': type_name, 'size': size_code,
+                                                    'layout': layout, 'fields': fields}
+                        return result
+
+                    elif method_name == 'persist':
+                        # buf = optim.persist(arr): wrap the heap storage of
+                        # a persisted array in a buffer object owned by the
+                        # Nagini runtime (zero-copy, buffer frees it)
+                        if not (call.args and isinstance(call.args[0], VariableIR)
+                                and call.args[0].name in nexc_arrays):
+                            raise ValueError(f"{context_var}.persist() expects a nexc array")
+                        arr = call.args[0].name
+                        info = nexc_arrays[arr]
+                        if info.get('layout') == 'soa':
+                            raise ValueError(f"{context_var}.persist() cannot persist a layout='soa' list; use the default AoS layout")
+                        result.append(f'{ind}{stmt.target} = ng_buffer_wrap(runtime, {arr}, sizeof({info["type"]}) * ({info["size"]}), sizeof({info["type"]}));')
+                        return result
+
+                    elif method_name == 'buffer':
+                        # arr = optim.buffer(buf, type=...): reattach a
+                        # persisted buffer as a native array view
+                        array_type = 'double'
+                        if call.kwargs and 'type' in call.kwargs:
+                            type_expr = call.kwargs['type']
+                            if isinstance(type_expr, AttributeIR):
+                                type_name = self._get_type_name_from_attr(type_expr)
+                                array_type = self._map_nexc_type_to_c(type_name)
+                        if not (call.args and isinstance(call.args[0], VariableIR)):
+                            raise ValueError(f"{context_var}.buffer() expects a buffer variable")
+                        buf_code = call.args[0].name
+                        result.append(f'{ind}{array_type}* {stmt.target} = ({array_type}*) ng_buffer_data(runtime, {buf_code});')
+                        nexc_arrays[stmt.target] = {'type': array_type, 'size': f'ng_buffer_count(runtime, {buf_code})'}
+                        return result
             
             # Check if this is an array element assignment
             if isinstance(stmt.value, BinOpIR) or isinstance(stmt.value, ConstantIR) or isinstance(stmt.value, VariableIR):
@@ -1001,12 +1516,36 @@ class LLVMBackend:
         
         elif isinstance(stmt, ForIR):
             # For loop - generate native C for loop
+            # optim.parallel_range(n): chunked multicore loop via OpenMP.
+            # Reductions reuse the same conservative body analysis as simd
+            # loops, so OpenMP keeps per-thread partials and combines them.
+            if (isinstance(stmt.iter_expr, CallIR)
+                    and isinstance(stmt.iter_expr.obj, VariableIR)
+                    and stmt.iter_expr.obj.name == context_var
+                    and stmt.iter_expr.func_name == 'parallel_range'
+                    and stmt.iter_expr.args):
+                end_code = self._gen_nexc_expr(stmt.iter_expr.args[0], nexc_arrays)
+                clause = self._nexc_simd_clause(stmt, nexc_arrays, context_var)
+                if clause is not None:
+                    pragma = f'#pragma omp parallel for schedule(static){clause}'
+                    if self._nexc_threads:
+                        pragma += f' num_threads({self._nexc_threads})'
+                    result.append(f'{ind}{pragma}')
+                result.append(f'{ind}for(int {stmt.target} = 0; {stmt.target} < {end_code}; {stmt.target}++) {{')
+                for body_stmt in stmt.body:
+                    result.extend(self._gen_nexc_stmt(body_stmt, indent + 1, nexc_arrays, context_var))
+                result.append(f'{ind}}}')
+                return result
+
             # Assume range-based iteration for now
             if isinstance(stmt.iter_expr, CallIR) and stmt.iter_expr.func_name == 'range':
                 # range(n) loop
                 if stmt.iter_expr.args:
                     end_expr = stmt.iter_expr.args[0]
                     end_code = self._gen_nexc_expr(end_expr, nexc_arrays)
+                    simd_clause = self._nexc_simd_clause(stmt, nexc_arrays, context_var)
+                    if simd_clause is not None:
+                        result.append(f'{ind}#pragma omp simd{simd_clause}')
                     result.append(f'{ind}for(int {stmt.target} = 0; {stmt.target} < {end_code}; {stmt.target}++) {{')
                     
                     # Generate body
@@ -1037,7 +1576,18 @@ class LLVMBackend:
                 result.extend(self._gen_nexc_stmt(body_stmt, indent + 1, nexc_arrays, context_var))
             result.append(f'{ind}}}')
             return result
-        
+
+        elif (isinstance(stmt, SetAttrIR) and isinstance(stmt.obj, SubscriptIR)
+                and isinstance(stmt.obj.obj, VariableIR)
+                and stmt.obj.obj.name in nexc_arrays):
+            # Record field store (pts[i].x = value): the AttributeIR path
+            # resolves the lvalue for both layouts (struct member for AoS,
+            # per-field array for SoA)
+            lhs = self._gen_nexc_expr(AttributeIR(stmt.obj, stmt.attr), nexc_arrays)
+            value_code = self._gen_nexc_expr(stmt.value, nexc_arrays)
+            result.append(f'{ind}{lhs} = {value_code};')
+            return result
+
         # Fallback: generate standard statement
         result.extend(self._gen_stmt(stmt, indent))
         return result
@@ -1093,15 +1643,26 @@ class LLVMBackend:
         
         elif isinstance(expr, AttributeIR):
             # Attribute access (e.g., v.x)
+            # Record element on a struct-of-arrays list: pts[i].x reads the
+            # per-field array (pts_x[i]) rather than a struct member
+            if (isinstance(expr.obj, SubscriptIR)
+                    and isinstance(expr.obj.obj, VariableIR)
+                    and nexc_arrays.get(expr.obj.obj.name, {}).get('layout') == 'soa'):
+                const_value, _ = self.ir.consts[expr.attr]
+                attr_name = const_value.strip('"') if isinstance(const_value, str) else str(const_value)
+                index = self._gen_nexc_expr(expr.obj.index, nexc_arrays)
+                return f'{expr.obj.obj.name}_{attr_name}[{index}]'
             # Check if obj is a native variable (in nexc_arrays) or external Nagini object
             if isinstance(expr.obj, VariableIR):
                 var_name = expr.obj.name
                 # If the variable is NOT in nexc_arrays, it's from outside the nexc block
                 # and we need to use NgGetMember
                 if var_name not in nexc_arrays:
-                    # External Nagini object - use runtime function
+                    # External Nagini object - use runtime function; the
+                    # value is consumed immediately, so a borrowed read is
+                    # enough
                     attr_const_id = expr.attr
-                    return f'NgGetMember(runtime, {var_name}, runtime->constants[{attr_const_id}])'
+                    return f'NgGetMemberBorrowed(runtime, {var_name}, runtime->constants[{attr_const_id}])'
             
             # Native variable attribute access (or fallback)
             obj = self._gen_nexc_expr(expr.obj, nexc_arrays)
@@ -1138,7 +1699,7 @@ class LLVMBackend:
                         if var_name not in nexc_arrays:
                             # This is accessing a Nagini object from outside nexc
                             # Use NgGetMember + NgCastTo* functions
-                            member_access = f'NgGetMember(runtime, {var_name}, runtime->constants[{value_expr.attr}])'
+                            member_access = f'NgGetMemberBorrowed(runtime, {var_name}, runtime->constants[{value_expr.attr}])'
                             
                             # Determine which cast function to use based on target type
                             if type_name in ['float', 'fp64', 'fp32', 'fp16', 'fp8', 'fp4']:
@@ -1201,6 +1762,58 @@ class LLVMBackend:
         }
         return type_map.get(type_name, 'double')
     
+    def _gen_direct_call(self, c_func_name: str, args) -> str:
+        """Generate a call to a compile-time-resolved function without
+        allocating the argument Tuple on the heap.
+
+        The argument Tuple is built on the C stack inside a statement
+        expression and marked immortal, so the callee borrows the items for
+        the duration of the call and no refcount or pool traffic happens.
+        Dynamic calls (method dispatch through NgCall) keep the heap Tuple
+        path.
+        """
+        if not args:
+            return f'{c_func_name}(runtime, NULL, NULL)'
+        arg_codes = [self._gen_expr(a) for a in args]
+        var = f'__cargs_{gen_uuid(16)}'
+        parts = [f'({{ struct {{ Tuple t; Object* rest[{len(args)}]; }} {var} = {{0}};']
+        parts.append(f'{var}.t.base.__flags__.type = OBJ_TYPE_TUPLE;')
+        parts.append(f'{var}.t.base.__refcount__ = NG_IMMORTAL_REFCOUNT;')
+        parts.append(f'{var}.t.size = {len(args)};')
+        for i, code in enumerate(arg_codes):
+            parts.append(f'{var}.t.items[{i}] = {code};')
+        parts.append(f'{c_func_name}(runtime, &{var}.t, NULL); }})')
+        return ' '.join(parts)
+
+    def _gen_member_cache_access(self, obj_code: str, attr_const_id: int) -> str:
+        """Generate an attribute read through a per-call-site inline cache.
+
+        Each site gets its own static NgMemberCache slot (via a GNU statement
+        expression, which gcc/clang both support), so monomorphic attribute
+        access in hot loops skips the dict probe after the first hit.
+        """
+        cache_name = f'__mc_{gen_uuid(16)}'
+        func = 'NgGetMemberCachedBorrowed' if self._borrow_member_reads else 'NgGetMemberCached'
+        return (f'({{ static NgMemberCache {cache_name}; '
+                f'{func}(runtime, {obj_code}, '
+                f'runtime->constants[{attr_const_id}], &{cache_name}); }})')
+
+    def _gen_temp_expr(self, expr: ExprIR) -> str:
+        """Generate an expression whose value is consumed within the current
+        statement (a condition, call argument or expression statement).
+
+        Attribute reads inside it borrow the owner's reference instead of
+        taking a new one: the instance keeps the value alive for the length
+        of the statement, and any callee that retains the value takes its
+        own reference when storing it.
+        """
+        prev = self._borrow_member_reads
+        self._borrow_member_reads = True
+        try:
+            return self._gen_expr(expr)
+        finally:
+            self._borrow_member_reads = prev
+
     def _gen_expr(self, expr: ExprIR) -> str:
         """Generate C code for an expression IR node"""
         if isinstance(expr, ConstantIR):
@@ -1343,7 +1956,7 @@ class LLVMBackend:
                     args_code = f'{obj_code}, {args_code}'
                 else:
                     args_code = f'{obj_code}'
-                getmember = f'NgGetMember(runtime, {obj_code}, runtime->constants[{expr.func_id}])'
+                getmember = self._gen_member_cache_access(obj_code, expr.func_id)
                 return f'NgCall(runtime, {getmember}, alloc_tuple(runtime, {len(args) + 1}, (Object*[]) {{{args_code}}}), NULL)'
             else:
                 # Regular function call
@@ -1385,6 +1998,20 @@ class LLVMBackend:
                         return f'NgLen(runtime, (Tuple*) alloc_tuple(runtime, 1, (Object*[]) {{{arg_code}}}), NULL)'
                     else:
                         raise ValueError('len() requires one argument')
+                elif expr.func_name == 'NgTrimMemory':
+                    # Release empty pool pages back to the OS
+                    if expr.args:
+                        arg_code = self._gen_expr(expr.args[0])
+                        return f'NgTrimMemory(runtime, (Tuple*) alloc_tuple(runtime, 1, (Object*[]) {{{arg_code}}}), NULL)'
+                    return 'NgTrimMemory(runtime, NULL, NULL)'
+                elif expr.func_name == 'gc_collect':
+                    # Run one cycle-collection pass (no-op unless NAGINI_GC
+                    # is set); returns the number of objects freed
+                    return 'NgGcCollect(runtime, NULL, NULL)'
+                elif expr.func_name == 'runtime_stats':
+                    # Snapshot of allocator/dict/refcount telemetry as a
+                    # dict; the same numbers NAGINI_STATS dumps at exit
+                    return 'NgRuntimeStats(runtime, NULL, NULL)'
                 elif expr.func_name == 'list':
                     if expr.args:
                         arg_code = self._gen_expr(expr.args[0])
@@ -1400,10 +2027,43 @@ class LLVMBackend:
                         arg_code = self._gen_expr(expr.args[0])
                         return f'NgSetFromIterable(runtime, {arg_code})'
                     return 'alloc_set(runtime)'
+                elif expr.func_name == 'open':
+                    return f'NgFileOpen(runtime, (Tuple*){tup}, (Dict*){kwa})'
+                elif expr.func_name == 'spawn':
+                    # spawn(f, args...): f is resolved to its C function at
+                    # compile time (functions are not first-class); the
+                    # remaining arguments are copied into the new thread's
+                    # Runtime shard by NgSpawn
+                    if not expr.args or not isinstance(expr.args[0], VariableIR):
+                        raise ValueError('spawn() requires a function name as its first argument')
+                    target = expr.args[0].name
+                    ident = fun_ids.get(target)
+                    if not ident:
+                        ident = gen_uuid(16)
+                        fun_ids[target] = ident
+                    rest = expr.args[1:]
+                    if rest:
+                        rest_code = ', '.join(self._gen_expr(a) for a in rest)
+                        spawn_args = f'(Tuple*) alloc_tuple(runtime, {len(rest)}, (Object*[]) {{{rest_code}}})'
+                    else:
+                        spawn_args = 'NULL'
+                    return f'NgSpawn(runtime, &{target}_{ident}, {spawn_args})'
+                elif expr.func_name == 'join':
+                    return f'NgJoin(runtime, (Tuple*){tup}, NULL)'
+                elif expr.func_name == 'atomic_int':
+                    return f'NgAtomicInt(runtime, (Tuple*){tup}, NULL)'
+                elif expr.func_name == 'atomic_add':
+                    return f'NgAtomicAdd(runtime, (Tuple*){tup}, NULL)'
+                elif expr.func_name == 'atomic_get':
+                    return f'NgAtomicGet(runtime, (Tuple*){tup}, NULL)'
                 ident = fun_ids.get(expr.func_name)
                 if not ident:
                     ident = gen_uuid(16)
                     fun_ids[expr.func_name] = ident
+                if kwa == 'NULL':
+                    # Target and arity resolved at compile time: skip the
+                    # heap Tuple and pass arguments on the C stack
+                    return self._gen_direct_call(f'{expr.func_name}_{ident}', expr.args)
                 return f'{expr.func_name}_{ident}(runtime, (Tuple*){tup}, (Dict*){kwa})'
         
         elif isinstance(expr, AttributeIR):
@@ -1441,7 +2101,8 @@ class LLVMBackend:
                         return f'self_native->{field_name}'
             
             # Object paradigm or accessing other objects: use hash table
-            return f'NgGetMember(runtime, {obj_code}, runtime->constants[{expr.attr}])'
+            # behind a per-call-site inline cache
+            return self._gen_member_cache_access(obj_code, expr.attr)
         
         elif isinstance(expr, SubscriptIR):
             # Subscript access (obj[index])
@@ -1500,45 +2161,120 @@ class LLVMBackend:
         }
         return type_map.get(nagini_type, 'void*')
     
-    def compile_to_executable(self, output_path: str, c_code: str) -> bool:
+    def _runtime_library(self, compiler: str, flags: list):
+        """Build (or reuse) the precompiled runtime library for a
+        compiler/flag combination.
+
+        The archive is cached under ~/.cache/nagini/rt keyed by a hash of
+        the compiler, the flags and the runtime sources themselves, so the
+        whole runtime is compiled once per toolchain instead of once per
+        .nag file. Returns the path to libnagini_rt.a, or None when the
+        library cannot be built with this compiler.
+        """
+        import hashlib
+        import subprocess
+
+        runtime_source = '\n'.join(
+            self._runtime_prelude()
+            + [load_c_from_file('hmap.h'), load_c_from_file('pool.h'), load_c_from_file('builtin.h')]
+        )
+        key = hashlib.sha256(
+            '\x00'.join([compiler, ' '.join(flags), runtime_source]).encode('utf-8')
+        ).hexdigest()[:16]
+        cache_dir = os.path.join(os.path.expanduser('~'), '.cache', 'nagini', 'rt', key)
+        lib_path = os.path.join(cache_dir, 'libnagini_rt.a')
+        if os.path.exists(lib_path):
+            return lib_path
+
+        os.makedirs(cache_dir, exist_ok=True)
+        rt_c = os.path.join(cache_dir, 'nagini_rt.c')
+        rt_o = os.path.join(cache_dir, 'nagini_rt.o')
+        with open(rt_c, 'w') as f:
+            f.write(runtime_source)
+        compile_flags = [flag for flag in flags if not flag.startswith('-l')]
+        try:
+            result = subprocess.run(
+                [compiler, '-c', rt_c, '-o', rt_o] + compile_flags,
+                capture_output=True,
+                text=True
+            )
+            if result.returncode != 0:
+                return None
+            result = subprocess.run(
+                ['ar', 'rcs', lib_path, rt_o],
+                capture_output=True,
+                text=True
+            )
+            if result.returncode != 0:
+                return None
+        except FileNotFoundError:
+            return None
+        return lib_path
+
+    def compile_to_executable(self, output_path: str, c_code: str, extra_flags: list = None) -> bool:
         """
         Compile generated C code to executable using gcc/clang.
-        
+
         Args:
             output_path: Path to output executable
             c_code: Generated C code
-            
+            extra_flags: Additional compiler flags appended to every flag
+                set tried (used by the CLI's PGO pipeline for
+                -fprofile-generate/-fprofile-use)
+
         Returns:
             True if compilation successful, False otherwise
         """
         import tempfile
         import subprocess
         import os
-        
+
         # Write C code to temporary file
         with tempfile.NamedTemporaryFile(mode='w', suffix='.c', delete=False) as f:
             f.write(c_code)
             c_file = f.name
-        
+
         try:
-            # Try to compile with gcc (or clang as fallback)
+            # Try to compile with gcc (or clang as fallback).
+            # -fopenmp enables both the parallel_range loops and the simd
+            # hints emitted for nexc blocks; compilers without OpenMP fall
+            # back to -fopenmp-simd (hints only, no runtime) and finally to
+            # the plain flag set, where the pragmas are ignored.
             compilers = ['gcc', 'clang', 'cc']
+            flag_sets = [
+                ['-O2', '-fopenmp', '-pthread', '-lm'],
+                ['-O2', '-fopenmp-simd', '-pthread', '-lm'],
+                ['-pthread', '-lm'],
+            ]
+            last_error = None
             for compiler in compilers:
-                try:
-                    result = subprocess.run(
-                        [compiler, c_file, '-o', output_path, '-lm'],
-                        capture_output=True,
-                        text=True
-                    )
-                    if result.returncode == 0:
-                        return True
-                    else:
-                        print(f"Compilation error with {compiler}:")
-                        print(result.stderr)
-                except FileNotFoundError:
-                    continue
-            
-            print("No C compiler found. Please install gcc or clang.")
+                for flags in flag_sets:
+                    if extra_flags:
+                        flags = flags + extra_flags
+                    try:
+                        cmd = [compiler, c_file, '-o', output_path] + flags
+                        if self.separate_runtime:
+                            lib = self._runtime_library(compiler, flags)
+                            if lib is None:
+                                continue
+                            cmd = [compiler, c_file, lib, '-o', output_path] + flags
+                        result = subprocess.run(
+                            cmd,
+                            capture_output=True,
+                            text=True
+                        )
+                        if result.returncode == 0:
+                            return True
+                        else:
+                            last_error = (compiler, result.stderr)
+                    except FileNotFoundError:
+                        break
+
+            if last_error:
+                print(f"Compilation error with {last_error[0]}:")
+                print(last_error[1])
+            else:
+                print("No C compiler found. Please install gcc or clang.")
             return False
             
         finally:
@@ -28,7 +28,11 @@ typedef enum {
     OBJ_TYPE_FUNCTION  = 10,
     OBJ_TYPE_VIEW      = 11,
     OBJ_TYPE_ITER      = 12,
-    OBJ_TYPE_NATIVE    = 13
+    OBJ_TYPE_NATIVE    = 13,
+    OBJ_TYPE_BUFFER    = 14,
+    OBJ_TYPE_THREAD    = 15,
+    OBJ_TYPE_ATOMIC    = 16,
+    OBJ_TYPE_FILE      = 17
 } ObjectType;
 
 const char* obj_type_names[] = {
@@ -44,7 +48,12 @@ const char* obj_type_names[] = {
     "set",
     "function",
     "view",
-    "iterator"
+    "iterator",
+    "native",
+    "buffer",
+    "thread",
+    "atomic",
+    "file"
 };
 
 typedef enum {
@@ -52,10 +61,37 @@ typedef enum {
     ALLOC_TYPE_MANUAL = 1
 } AllocationType;
 
+/* Hot-path counters for the profiler's exit report (NAGINI_PROFILE).
+ * Plain unconditional increments, same deal as ng_pool_alloc_count
+ * (thread-local: the report covers the main thread). */
+_Thread_local uint64_t ng_call_count = 0;
+_Thread_local uint64_t ng_member_read_count = 0;
+_Thread_local uint64_t ng_dict_lookup_count = 0;
+
+/* Telemetry for NgRuntimeStats() and the NAGINI_STATS exit dump. Same
+ * discipline as the profiler counters above: plain unconditional adds on
+ * paths that already do real work, cheap enough to leave on everywhere,
+ * and thread-local so spawn() shards don't contend. Dict probe counters
+ * measure index-probe chain lengths; the live/entry/slot aggregates give
+ * a whole-process load factor without keeping a registry of dicts. */
+_Thread_local uint64_t ng_alloc_class_count[64] = {0};
+_Thread_local uint64_t ng_alloc_large_count = 0;
+_Thread_local uint64_t ng_alloc_mmap_count = 0;
+_Thread_local uint64_t ng_incref_count = 0;
+_Thread_local uint64_t ng_decref_count = 0;
+_Thread_local uint64_t ng_dict_probe_count = 0;
+_Thread_local uint64_t ng_dict_probe_max = 0;
+_Thread_local uint64_t ng_dict_live_count = 0;
+_Thread_local uint64_t ng_dict_live_entries = 0;
+_Thread_local uint64_t ng_dict_index_slots = 0;
+
 /* Function prototypes that depend on Runtime */
+int32_t get_symbol_id(Runtime* runtime, const char* name);
 void* alloc(Runtime* runtime, size_t size, bool* is_manual, int* pool_id, bool zeroed);
 void del(Runtime* runtime, void* ptr, bool is_manual, int pool_id);
 Object* alloc_str(Runtime* runtime, const char* data);
+Object* alloc_str_interned(Runtime* runtime, const char* data);
+void ng_init_builtin_names(Runtime* runtime);
 Object* alloc_int(Runtime* runtime, int64_t value);
 Object* alloc_float(Runtime* runtime, double value);
 Object* alloc_bytes(Runtime* runtime, const char* data, size_t len);
@@ -117,6 +153,7 @@ Object* NgMul(Runtime* runtime, void* aa, void* bb);
 Object* NgTrueDiv(Runtime* runtime, void* aa, void* bb);
 Object* NgFloorDiv(Runtime* runtime, void* aa, void* bb);
 Object* NgGetMember(Runtime* runtime, void* ii, void* mm);
+Object* NgGetMemberBorrowed(Runtime* runtime, void* ii, void* mm);
 Object* NgMod(Runtime* runtime, void* aa, void* bb);
 Object* NgPow(Runtime* runtime, void* aa, void* bb);
 void NgSetMember(Runtime* runtime, void* ii, void* mm, void* vv);
@@ -125,10 +162,30 @@ void NgSetItem(Runtime* runtime, void* obj, void* index, void* value);
 void NgDelMember(Runtime* runtime, InstanceObject* instance, StringObject* member);
 Object* NgToString(Runtime* runtime, void* obj);
 const char* NgToCString(Runtime* runtime, void* obj);
+Object* NgCatStr(Runtime* runtime, Object* a, Object* b);
 Object* NgCall(Runtime* runtime, void* func, void* args, void* kwargs);
 void NgGetTypeName(Runtime* runtime, void* oo, char* buffer, size_t size);
 int64_t NgCastToInt(Runtime* runtime, void* obj);
 Object* alloc_list_prefill(Runtime* runtime, size_t size, Object** items);
+Object* ng_buffer_wrap(Runtime* runtime, void* data, size_t nbytes, size_t elem_size);
+Object* ng_buffer_view(Runtime* runtime, void* data, size_t nbytes, size_t elem_size);
+void* ng_buffer_data(Runtime* runtime, void* obj);
+size_t ng_buffer_count(Runtime* runtime, void* obj);
+Object* NgSpawn(Runtime* runtime, Object* (*fn)(Runtime*, Tuple*, Dict*), Tuple* args);
+Object* NgJoin(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgAtomicInt(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgAtomicAdd(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgAtomicGet(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgFileOpen(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgFileRead(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgFileReadInto(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgFileWrite(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgFileClose(Runtime* runtime, Tuple* args, Dict* kwargs);
+void ng_gc_track(Runtime* runtime, Object* o);
+void ng_gc_untrack(Runtime* runtime, Object* o);
+size_t ng_gc_collect(Runtime* runtime);
+Object* NgGcCollect(Runtime* runtime, Tuple* args, Dict* kwargs);
+Object* NgRuntimeStats(Runtime* runtime, Tuple* args, Dict* kwargs);
 
 #if defined(__linux__) || defined(__unix__)
 void siphash_random_key(uint8_t key[16]) {
@@ -278,6 +335,20 @@ typedef struct Object {
     int32_t         __refcount__;   /* Reference counter (outside programmer control) */
 } Object;
 
+/*
+    Immortal objects (small-int cache, interned constants) carry a sentinel
+    refcount. INCREF/DECREF treat anything at or above the sentinel as a
+    no-op, so hot arithmetic loops never touch the pool for them. The
+    sentinel sits well below INT32_MAX so a stray unguarded increment can
+    never wrap the counter.
+*/
+#define NG_IMMORTAL_REFCOUNT (INT32_MAX >> 1)
+
+/* Preallocated small ints, CPython-style: [-5, 256] */
+#define NG_SMALL_INT_MIN  (-5)
+#define NG_SMALL_INT_MAX  257
+#define NG_SMALL_INT_COUNT (NG_SMALL_INT_MAX - NG_SMALL_INT_MIN)
+
 /* Base Object class - all Nagini objects inherit from this */
 typedef struct Bool {
     Object base;
@@ -332,13 +403,69 @@ typedef struct Tuple {
     Object*         items[1];
 } Tuple;
 
+/* * SMALL TUPLE FREELISTS
+ * Virtually every tuple the runtime builds has arity 1-4: argument
+ * packs for method calls and the key/value pairs NgDictItems produces.
+ * Rather than hitting malloc for each one, DECREF parks dead tuples of
+ * those arities on a per-arity freelist (chained through items[0], which
+ * is dead storage at that point) and alloc_tuple pops them back off.
+ * The lists are bounded so a burst of tuple churn cannot pin memory
+ * forever; anything past the cap is released normally.
+ */
+#define NG_TUPLE_FREELIST_ARITIES 4
+#define NG_TUPLE_FREELIST_MAX     64
+
+/* * Buffer-backed view over a persistent nexc allocation (zero-copy).
+ * `optim.persist(arr)` hands the native heap buffer over to one of these;
+ * later nexc blocks reattach with `optim.buffer(buf, type=...)` and regular
+ * Nagini code can hold/len() it without boxing elements. A wrapping buffer
+ * owns its data and frees it when the refcount drops; a view (owns_data
+ * false) borrows memory owned by someone else, e.g. a file mapping.
+ */
+typedef struct BufferObject {
+    InstanceObject base;
+    size_t         size;       /* total bytes */
+    size_t         elem_size;  /* bytes per element */
+    void*          data;
+    bool           owns_data;
+} BufferObject;
+
+/* * File handle returned by open(). Buffered modes wrap a FILE* with a
+ * 1MB stdio buffer; mode "m" maps the file read-only and read() hands out
+ * zero-copy buffer views into the mapping. The mapping stays valid until
+ * close() or the last reference is dropped; the DECREF arm closes the
+ * FILE* / unmaps whatever close() has not already released.
+ */
+typedef struct FileObject {
+    InstanceObject base;
+    FILE*          fp;          /* NULL in mapped mode */
+    char*          map_data;    /* NULL in buffered modes */
+    size_t         map_size;
+    size_t         map_pos;     /* read cursor into the mapping */
+    bool           map_is_mmap; /* false when the fallback path copied */
+} FileObject;
+
 /// LIST
+
+/* * Storage modes
+ * A list built by appending only ints (or only floats) keeps its elements
+ * as a contiguous unboxed array instead of one pooled box per element —
+ * int64_t, double and Object* are all 8 bytes, so `items` is reinterpreted
+ * in place. Appending a foreign type, or any operation that needs real
+ * element objects (find, tostring, extend, contains, ...), boxes everything
+ * via list_spill_to_objects and drops back to LIST_STORE_OBJ.
+ */
+#define LIST_STORE_OBJ 0  /* boxed Object* elements */
+#define LIST_STORE_I64 1  /* unboxed int64_t values */
+#define LIST_STORE_F64 2  /* unboxed double values */
+
 typedef struct List {
     Object          base;
     Dict*           __dict__;
     size_t          size;
     size_t          capacity;
     Object**        items;
+    uint8_t         store;    /* LIST_STORE_* */
 } List;
 
 /* * Initialize the list. 
@@ -347,6 +474,7 @@ typedef struct List {
  */
 void list_init(Runtime* runtime, List* list, size_t initial_capacity) {
     list->size = 0;
+    list->store = LIST_STORE_OBJ;
     list->capacity = (initial_capacity > 0) ? initial_capacity : 4;
     bool is_manual;
     int pool_id;
@@ -356,18 +484,58 @@ void list_init(Runtime* runtime, List* list, size_t initial_capacity) {
         fprintf(stderr, "MemoryError\n");
         exit(1);
     }
+    // The header's allocation bits track the items array (the header
+    // itself always lives in the typed list pool); the grow paths in
+    // list_append/list_add keep them updated
+    list->base.__allocation__.is_manual = is_manual ? 1 : 0;
+    list->base.__allocation__.pool_id = pool_id;
+}
+
+/* * Box every unboxed element in place and fall back to Object* storage.
+ * Unboxed values and Object* are the same width, so the array is reused.
+ */
+void list_spill_to_objects(Runtime* runtime, List* list) {
+    if (list->store == LIST_STORE_OBJ) return;
+    if (list->store == LIST_STORE_I64) {
+        int64_t* values = (int64_t*)list->items;
+        for (size_t i = 0; i < list->size; i++) {
+            list->items[i] = alloc_int(runtime, values[i]);
+        }
+    } else {
+        double* values = (double*)list->items;
+        for (size_t i = 0; i < list->size; i++) {
+            list->items[i] = alloc_float(runtime, values[i]);
+        }
+    }
+    list->store = LIST_STORE_OBJ;
 }
 
-/* * Append: Grows the list geometrically (2x) 
+/* * Append: Grows the list geometrically (2x)
+ * Takes a new reference on `item` when it is stored boxed; in unboxed
+ * mode only the value is copied and `item` is left untouched.
  */
 #define LIST_GROWTH 2
 int list_append(Runtime* runtime, List* list, Object* item) {
+    // An empty boxed list adopts unboxed storage on its first numeric
+    // append; a typed list spills as soon as a foreign type arrives.
+    if (list->store == LIST_STORE_OBJ && list->size == 0 && item) {
+        if (item->__flags__.type == OBJ_TYPE_INT) list->store = LIST_STORE_I64;
+        else if (item->__flags__.type == OBJ_TYPE_FLOAT) list->store = LIST_STORE_F64;
+    } else if (list->store == LIST_STORE_I64 &&
+               (!item || item->__flags__.type != OBJ_TYPE_INT)) {
+        list_spill_to_objects(runtime, list);
+    } else if (list->store == LIST_STORE_F64 &&
+               (!item || item->__flags__.type != OBJ_TYPE_FLOAT)) {
+        list_spill_to_objects(runtime, list);
+    }
+
     if (list->size >= list->capacity) {
         size_t new_size = list->capacity * LIST_GROWTH;
         bool is_manual;
         int pool_id;
+        // Element width is 8 bytes in every storage mode
         Object** new_items = (Object**) alloc(runtime, sizeof(Object*) * new_size, &is_manual, &pool_id, false);
-        
+
         // (Object**)realloc(list->items, new_size * sizeof(Object*));
         if (!new_items) return -1; /* list->items remains valid on failure */
         memcpy(new_items, list->items, sizeof(Object*) * list->capacity);
@@ -378,7 +546,18 @@ int list_append(Runtime* runtime, List* list, Object* item) {
         list->capacity = new_size;
     }
 
-    list->items[list->size++] = item;
+    switch (list->store) {
+        case LIST_STORE_I64:
+            ((int64_t*)list->items)[list->size++] = ((IntObject*)item)->__value__;
+            break;
+        case LIST_STORE_F64:
+            ((double*)list->items)[list->size++] = ((FloatObject*)item)->__value__;
+            break;
+        default:
+            INCREF(runtime, item);
+            list->items[list->size++] = item;
+            break;
+    }
     return 0;
 }
 
@@ -395,7 +574,7 @@ void NgAppend(Runtime* runtime, Tuple* args, Dict* kwargs) {
     List* list = (List*)args->items[0];
     Object* item = args->items[1];
 
-    list_append(runtime, list, (Object*)INCREF(runtime, item));
+    list_append(runtime, list, item);
 }
 
 /* * Find: Returns index or -1 
@@ -422,6 +601,7 @@ Object* NgIndex(Runtime* runtime, Tuple* args, Dict* kwargs) {
     List* list = (List*)args->items[0];
     Object* item = args->items[1];
 
+    list_spill_to_objects(runtime, list);
     int64_t index = list_find(list, item);
     if (index == -1) {
         fprintf(stderr, "ValueError: list.index(): item not found in list\n");
@@ -461,6 +641,7 @@ void NgRemove(Runtime* runtime, Tuple* args, Dict* kwargs) {
     List* list = (List*)args->items[0];
     Object* item = args->items[1];
 
+    list_spill_to_objects(runtime, list);
     int64_t index = list_find(list, item);
     if (index == -1) {
         fprintf(stderr, "ValueError: list.remove(): item not found in list\n");
@@ -476,6 +657,8 @@ void NgRemove(Runtime* runtime, Tuple* args, Dict* kwargs) {
 /* * Add (Concatenate): Efficiently joins two lists
  */
 int list_add(Runtime* runtime, List* list, List* other) {
+    list_spill_to_objects(runtime, list);
+    list_spill_to_objects(runtime, other);
     size_t total_needed = list->size + other->size;
 
     if (total_needed > list->capacity) {
@@ -556,6 +739,7 @@ Object* NgPop(Runtime* runtime, Tuple* args, Dict* kwargs) {
             exit(1);
         }
 
+        list_spill_to_objects(runtime, list);
         Object* item = list_remove(list, (size_t)idx);
         return item;
     } else if (argc == 1) {
@@ -564,6 +748,12 @@ Object* NgPop(Runtime* runtime, Tuple* args, Dict* kwargs) {
             exit(1);
         }
 
+        if (list->store == LIST_STORE_I64) {
+            return alloc_int(runtime, ((int64_t*)list->items)[--list->size]);
+        }
+        if (list->store == LIST_STORE_F64) {
+            return alloc_float(runtime, ((double*)list->items)[--list->size]);
+        }
         Object* item = list->items[list->size - 1];
         list->size--;
         return item;
@@ -584,44 +774,156 @@ void NgClearList(Runtime* runtime, Tuple* args, Dict* kwargs) {
     }
 
     List* list = (List*)args->items[0];
-    for (size_t i = 0; i < list->size; i++) {
-        DECREF(runtime, list->items[i]);
+    if (list->store == LIST_STORE_OBJ) {
+        for (size_t i = 0; i < list->size; i++) {
+            DECREF(runtime, list->items[i]);
+        }
     }
     list->size = 0;
 }
 
 
 // Configuration
-#define DICT_INITIAL_CAPACITY 2 // Must be power of 2
-#define DICT_LOAD_FACTOR 85
+#define DICT_INITIAL_CAPACITY 2 // Index slots; must be power of 2
+
+/* * Compact, order-preserving layout (split table)
+ * Entries live in a dense array in insertion order; a separate
+ * open-addressed index table maps hash probes to entry positions.
+ * Iteration, str(), copy and the dict views walk only `used` contiguous
+ * 24-byte records - no capacity-wide sweep over sparse slots - and the
+ * order survives resizes, so dicts iterate in insertion order like
+ * CPython's. Deletes tombstone the dense slot (key = NULL) and the
+ * index slot (DICT_IX_DELETED); the next growth compacts them away.
+ * Rebuilding the index on resize touches no keys or values (positions
+ * are reinserted from cached hashes alone), which is cheap enough that
+ * the old incremental-migration machinery is gone.
+ */
+#define DICT_IX_EMPTY   ((int32_t)-1)
+#define DICT_IX_DELETED ((int32_t)-2)
 
 /* * The Dictionary Entry
- * Stores the Key Object, Value Object, and the Cached Hash.
- * Padded to typically 32 bytes on 64-bit systems.
+ * Key, value and the cached hash: 24 bytes, iterated contiguously.
+ * A NULL key marks a deleted slot in the dense array.
  */
 typedef struct {
     Object* key;
     Object* value;
     int64_t hash;    // Cached hash to avoid re-computing
-    uint32_t psl;    // Probe Sequence Length
 } dict_entry_t;
 
 typedef struct Dict {
     InstanceObject base; // Your base object header
-    
-    dict_entry_t* entries;
-    size_t capacity;
-    size_t count;
+
+    dict_entry_t* entries;  // Dense, insertion order; slots [0, used)
+    int32_t*      index;    // Open-addressed probe table of entry positions
+    size_t capacity;        // Index slots (power of 2); entries holds threshold slots
+    size_t used;            // Dense slots written (live entries + tombstones)
+    size_t count;           // Live entries
     size_t mask;
-    size_t threshold;
+    size_t threshold;       // Grow (or compact) when used reaches this
+    size_t version;    // Bumped on insert/delete/resize; validates inline caches
+
     struct {
         uint8_t is_manual:1;    // 0 = pool, 1 = manual
         uint8_t pool_id:6;      // Pool ID for pooled allocations (0-31)
         uint8_t boolean:1;
-    } __allocation__;
-    int8_t          __padding__[7]; /* Padding for alignment */
+    } __allocation__;           // Allocation bits of the entries array
+    struct {
+        uint8_t is_manual:1;
+        uint8_t pool_id:6;
+        uint8_t boolean:1;
+    } __index_allocation__;     // Allocation bits of the index table
+    int8_t          __padding__[4]; /* Padding for alignment */
 } Dict;
 
+/* * Per-call-site inline cache for attribute access.
+ * The backend emits one static NgMemberCache per attribute read site and
+ * NgGetMemberCached validates it with three compares before falling back to
+ * the full index probe. Inserts, deletes and resizes can all move or
+ * reallocate the dense entries array, so the dict version counter (bumped on
+ * every structural change) is what keeps a cached entry pointer honest;
+ * in-place value updates deliberately leave the version alone so `x.y = ...`
+ * in a loop keeps hitting.
+ */
+typedef enum {
+    NG_CACHE_EMPTY = 0,
+    NG_CACHE_SLOT  = 1,
+    NG_CACHE_DICT  = 2
+} NgMemberCacheKind;
+
+typedef struct NgMemberCache {
+    uint8_t       kind;         // NgMemberCacheKind
+    int32_t       typename_id;  // validates slot hits
+    int32_t       slot;         // fixed slot index for slot hits
+    Dict*         dict;
+    size_t        version;
+    dict_entry_t* entry;
+} NgMemberCache;
+
+/* * Fixed-offset slot layout for compiled classes.
+ * Classes whose attribute set is statically known from their field
+ * annotations store those attributes in an Object* array laid out directly
+ * after the InstanceObject header, instead of in the per-instance __dict__.
+ * def_class_X registers the layout (keyed by the class symbol id) so
+ * NgGetMember/NgSetMember and DECREF can route declared attributes to their
+ * slots; anything not in the layout still falls back to the dict.
+ */
+typedef struct NgSlotLayout {
+    size_t   count;
+    Object** names;   /* attr-name string constants, one per slot */
+} NgSlotLayout;
+
+#define NG_INSTANCE_SLOTS(instance) ((Object**)(((InstanceObject*)(instance)) + 1))
+
+void ng_register_slot_layout(Runtime* runtime, const char* class_name, size_t count, Object** names);
+NgSlotLayout* ng_slot_layout(Runtime* runtime, int32_t typename_id);
+
+/* Full string equality: hash first, then length, storage width and the
+ * character data itself. The data array starts right after the
+ * StringObject header for every width, so one memcmp covers all three
+ * unicode kinds. */
+static inline bool ng_string_eq(StringObject* a, StringObject* b) {
+    if (a == b) return true;
+    if (a->hash != b->hash || a->size != b->size) return false;
+    unsigned int kind = a->base.base.__flags__.reserved;
+    if (kind != b->base.base.__flags__.reserved) return false;
+    size_t width = (kind == 0) ? 1 : (kind == 1) ? 2 : 4;
+    return memcmp((void*)(a + 1), (void*)(b + 1), a->size * width) == 0;
+}
+
+static inline int ng_slot_index(NgSlotLayout* layout, StringObject* member) {
+    for (size_t i = 0; i < layout->count; i++) {
+        if (layout->names[i] == (Object*)member) return (int)i;
+    }
+    // Slow path for attribute names that are not the interned constant.
+    // A hash match alone would let a 64-bit collision resolve to the
+    // wrong slot, so the text is compared too.
+    for (size_t i = 0; i < layout->count; i++) {
+        if (ng_string_eq((StringObject*)layout->names[i], member)) return (int)i;
+    }
+    return -1;
+}
+
+/* * Recycle a range-loop counter box.
+ * When the previous iteration's IntObject is exclusively owned by the loop
+ * variable (refcount 1, so never an immortal cached int), the next value is
+ * written into it in place instead of allocating a fresh box. If the body
+ * retained the object anywhere, the refcount is above 1 and a new box is
+ * allocated as before.
+ */
+static inline Object* ng_int_reuse(Runtime* runtime, Object* obj, int64_t value) {
+    if (obj && obj->__flags__.type == OBJ_TYPE_INT && obj->__refcount__ == 1) {
+        ((IntObject*)obj)->__value__ = value;
+        return obj;
+    }
+    if (obj) DECREF(runtime, obj);
+    return alloc_int(runtime, value);
+}
+
+dict_entry_t* dict_get_entry(Runtime* runtime, void* dd, void* kk);
+Object* NgGetMemberCached(Runtime* runtime, void* ii, void* mm, NgMemberCache* cache);
+Object* NgGetMemberCachedBorrowed(Runtime* runtime, void* ii, void* mm, NgMemberCache* cache);
+
 typedef enum {
     VIEW_KEYS = 0,
     VIEW_VALUES = 1,
@@ -654,6 +956,9 @@ typedef struct NgIterator {
 
 // Helper: Check if two keys are effectively equal
 static inline bool ObjectsEqual(Runtime* runtime, Object* k1, Object* k2) {
+    // Interned names (builtin names, compile-time constants) are unique
+    // per text, so identical pointers settle most identifier lookups here
+    if (k1 == k2) return k1 != NULL;
     if (!k1 || !k2) return false;
     int type0 = k1->__flags__.type;
     int type1 = k2->__flags__.type;
@@ -719,19 +1024,103 @@ int64_t hash_float(FloatObject* fobj) {
 
 /* NgMember functions and dict functions - implementations provided after Runtime struct */
 
+/* * Borrowed attribute reads
+ * The Borrowed variants return the owner's reference without taking a new
+ * one. The backend emits them when the result is consumed within the same
+ * statement (conditions, call arguments, operands): the instance keeps the
+ * attribute alive for that long, and anything that retains the value —
+ * dict_set, list_append, NgSetMember, NgSetItem — takes its own reference.
+ * Values bound to locals or returned still go through the owning variants.
+ */
+Object* NgGetMemberBorrowed(Runtime* runtime, void* ii, void* mm) {
+    InstanceObject* instance = (InstanceObject*)ii;
+    StringObject* member = (StringObject*)mm;
+    ng_member_read_count++;
+
+    NgSlotLayout* layout = ng_slot_layout(runtime, instance->base.__typename__);
+    if (layout) {
+        int idx = ng_slot_index(layout, member);
+        if (idx >= 0) {
+            return NG_INSTANCE_SLOTS(instance)[idx];
+        }
+    }
+
+    Dict* dict = instance->__dict__;
+    if (!dict) return NULL;
+
+    return dict_get(runtime, dict, (Object*)member);
+}
+
 Object* NgGetMember(Runtime* runtime, void* ii, void* mm) {
+    return INCREF(runtime, NgGetMemberBorrowed(runtime, ii, mm));
+}
+
+Object* NgGetMemberCachedBorrowed(Runtime* runtime, void* ii, void* mm, NgMemberCache* cache) {
     InstanceObject* instance = (InstanceObject*)ii;
     StringObject* member = (StringObject*)mm;
+
+    // Fast path: slot attribute resolved at a previous hit on this site.
+    if (cache->kind == NG_CACHE_SLOT &&
+        cache->typename_id == instance->base.__typename__) {
+        return NG_INSTANCE_SLOTS(instance)[cache->slot];
+    }
+
     Dict* dict = instance->__dict__;
+
+    // Fast path: monomorphic dict hit from the last lookup at this call site.
+    if (cache->kind == NG_CACHE_DICT &&
+        cache->dict == dict &&
+        cache->version == dict->version &&
+        cache->entry->key == (Object*)member) {
+        return cache->entry->value;
+    }
+
+    NgSlotLayout* layout = ng_slot_layout(runtime, instance->base.__typename__);
+    if (layout) {
+        int idx = ng_slot_index(layout, member);
+        if (idx >= 0) {
+            cache->kind = NG_CACHE_SLOT;
+            cache->typename_id = instance->base.__typename__;
+            cache->slot = idx;
+            return NG_INSTANCE_SLOTS(instance)[idx];
+        }
+    }
+
     if (!dict) return NULL;
 
-    return INCREF(runtime, dict_get(runtime, dict, (Object*)member));
+    dict_entry_t* entry = dict_get_entry(runtime, dict, (Object*)member);
+    if (!entry) return NULL;
+
+    cache->kind = NG_CACHE_DICT;
+    cache->dict = dict;
+    cache->version = dict->version;
+    cache->entry = entry;
+    return entry->value;
+}
+
+Object* NgGetMemberCached(Runtime* runtime, void* ii, void* mm, NgMemberCache* cache) {
+    return INCREF(runtime, NgGetMemberCachedBorrowed(runtime, ii, mm, cache));
 }
 
 void NgSetMember(Runtime* runtime, void* ii, void* mm, void* vv) {
     InstanceObject* instance = (InstanceObject*)ii;
     StringObject* member = (StringObject*)mm;
     Object* value = (Object*)vv;
+
+    NgSlotLayout* layout = ng_slot_layout(runtime, instance->base.__typename__);
+    if (layout) {
+        int idx = ng_slot_index(layout, member);
+        if (idx >= 0) {
+            Object** slot = &NG_INSTANCE_SLOTS(instance)[idx];
+            if (*slot != value) {
+                INCREF(runtime, value);
+                if (*slot) DECREF(runtime, *slot);
+                *slot = value;
+            }
+            return;
+        }
+    }
+
     Dict* dict = instance->__dict__;
     if (!dict) {
         dict = alloc_dict_internal(runtime, /*add_methods=*/false);
@@ -757,6 +1146,14 @@ Object* NgGetItem(Runtime* runtime, void* obj, void* index) {
                 fprintf(stderr, "IndexError: list index out of range\n");
                 exit(1);
             }
+            // Unboxed elements are boxed on the way out, like any other
+            // value-producing expression; the storage stays unboxed.
+            if (list->store == LIST_STORE_I64) {
+                return alloc_int(runtime, ((int64_t*)list->items)[idx]);
+            }
+            if (list->store == LIST_STORE_F64) {
+                return alloc_float(runtime, ((double*)list->items)[idx]);
+            }
             return list->items[idx];
         }
         case OBJ_TYPE_TUPLE: {
@@ -802,6 +1199,18 @@ void NgSetItem(Runtime* runtime, void* obj, void* index, void* value) {
                 fprintf(stderr, "IndexError: list assignment index out of range\n");
                 exit(1);
             }
+            Object* v = (Object*)value;
+            if (list->store == LIST_STORE_I64 && v && v->__flags__.type == OBJ_TYPE_INT) {
+                ((int64_t*)list->items)[idx] = ((IntObject*)v)->__value__;
+                return;
+            }
+            if (list->store == LIST_STORE_F64 && v && v->__flags__.type == OBJ_TYPE_FLOAT) {
+                ((double*)list->items)[idx] = ((FloatObject*)v)->__value__;
+                return;
+            }
+            if (list->store != LIST_STORE_OBJ) {
+                list_spill_to_objects(runtime, list);
+            }
             if (list->items[idx] != value) {
                 Object* old_value = list->items[idx];
                 INCREF(runtime, value);
@@ -863,6 +1272,11 @@ inline Object* NgAdd(Runtime* runtime, void* aa, void* bb) {
         return alloc_float(runtime, result);
     }
 
+    // Handle string concatenation
+    if (a->__flags__.type == OBJ_TYPE_STRING && b->__flags__.type == OBJ_TYPE_STRING) {
+        return NgCatStr(runtime, a, b);
+    }
+
     // Unsupported types
     fprintf(stderr,
         "TypeError: unsupported operand type(s) for +: '%s' and '%s'\n",
@@ -1186,240 +1600,722 @@ typedef struct PoolCollection {
     dynamic_pool_t* powers_of_two[64];
 } PoolCollection;
 
+/* * STATIC BUILTIN NAMES
+ * Every method and dunder name the runtime looks up is listed once in
+ * NG_BUILTIN_NAMES, and the string objects backing them are static data
+ * baked into the binary rather than allocated one by one at startup.
+ * The only per-process work left is one pass in ng_init_builtin_names()
+ * that stamps type and hash fields -- hashes cannot be precomputed
+ * because the siphash key is randomized per process -- and registers
+ * each entry in the intern table, so compile-time string constants with
+ * the same text still come out pointer-equal to the builtin name.
+ */
+#define NG_BUILTIN_NAMES(X) \
+    X(none, "None") \
+    X(__typename__, "__typename__") \
+    \
+    X(append, "append") \
+    X(pop, "pop") \
+    X(remove, "remove") \
+    X(clear, "clear") \
+    X(index, "index") \
+    X(extend, "extend") \
+    X(add, "add") \
+    X(discard, "discard") \
+    X(set_union, "union") \
+    X(intersection, "intersection") \
+    X(difference, "difference") \
+    X(symmetric_difference, "symmetric_difference") \
+    X(isdisjoint, "isdisjoint") \
+    X(issubset, "issubset") \
+    X(issuperset, "issuperset") \
+    X(keys, "keys") \
+    X(values, "values") \
+    X(items, "items") \
+    X(get, "get") \
+    X(setdefault, "setdefault") \
+    X(popitem, "popitem") \
+    X(update, "update") \
+    X(copy, "copy") \
+    \
+    X(read, "read") \
+    X(readinto, "readinto") \
+    X(write, "write") \
+    X(close, "close") \
+    \
+    /* 1. Object Lifecycle & Memory Management */ \
+    X(__new__, "__new__") \
+    X(__init__, "__init__") \
+    X(__del__, "__del__") \
+    \
+    /* 2. String/Bytes Representation & Formatting */ \
+    X(__repr__, "__repr__") \
+    X(__str__, "__str__") \
+    X(__bytes__, "__bytes__") \
+    X(__format__, "__format__") \
+    \
+    /* 3. Comparison & Hashing */ \
+    X(__hash__, "__hash__") \
+    X(__eq__, "__eq__") \
+    X(__ne__, "__ne__") \
+    X(__lt__, "__lt__") \
+    X(__le__, "__le__") \
+    X(__gt__, "__gt__") \
+    X(__ge__, "__ge__") \
+    \
+    /* 4. Attribute Access & Descriptors */ \
+    X(__getattr__, "__getattr__") \
+    X(__getattribute__, "__getattribute__") \
+    X(__setattr__, "__setattr__") \
+    X(__delattr__, "__delattr__") \
+    X(__dir__, "__dir__") \
+    \
+    /* Descriptors */ \
+    X(__get__, "__get__") \
+    X(__set__, "__set__") \
+    X(__delete__, "__delete__") \
+    X(__set_name__, "__set_name__") \
+    X(__objclass__, "__objclass__") \
+    X(__slots__, "__slots__") \
+    X(__dict__, "__dict__") \
+    X(__weakref__, "__weakref__") \
+    \
+    /* 5. Class Structure & Imports */ \
+    X(__doc__, "__doc__") \
+    X(__name__, "__name__") \
+    X(__qualname__, "__qualname__") \
+    X(__module__, "__module__") \
+    X(__package__, "__package__") \
+    X(__file__, "__file__") \
+    X(__path__, "__path__") \
+    X(__loader__, "__loader__") \
+    X(__spec__, "__spec__") \
+    X(__annotations__, "__annotations__") \
+    \
+    X(__class__, "__class__") \
+    X(__bases__, "__bases__") \
+    X(__mro__, "__mro__") \
+    X(__subclasses__, "__subclasses__") \
+    X(__init_subclass__, "__init_subclass__") \
+    X(__class_getitem__, "__class_getitem__") \
+    X(__mro_entries__, "__mro_entries__") \
+    \
+    /* 6. Containers (Sequences, Mappings) */ \
+    X(__len__, "__len__") \
+    X(__length_hint__, "__length_hint__") \
+    X(__getitem__, "__getitem__") \
+    X(__setitem__, "__setitem__") \
+    X(__delitem__, "__delitem__") \
+    X(__iter__, "__iter__") \
+    X(__next__, "__next__") \
+    X(__reversed__, "__reversed__") \
+    X(__contains__, "__contains__") \
+    X(__missing__, "__missing__") \
+    \
+    /* 7. Callable & Context Managers */ \
+    X(__call__, "__call__") \
+    X(__enter__, "__enter__") \
+    X(__exit__, "__exit__") \
+    \
+    /* 8. Asynchronous Programming */ \
+    X(__await__, "__await__") \
+    X(__aiter__, "__aiter__") \
+    X(__anext__, "__anext__") \
+    X(__aenter__, "__aenter__") \
+    X(__aexit__, "__aexit__") \
+    \
+    /* 9. Numeric Types & Coercion */ \
+    X(__bool__, "__bool__") \
+    X(__int__, "__int__") \
+    X(__float__, "__float__") \
+    X(__complex___, "__complex__") \
+    X(__index__, "__index__") \
+    X(__round__, "__round__") \
+    X(__trunc__, "__trunc__") \
+    X(__floor__, "__floor__") \
+    X(__ceil__, "__ceil__") \
+    \
+    /* 10. Arithmetic Operators (Binary) */ \
+    X(__add__, "__add__") \
+    X(__sub__, "__sub__") \
+    X(__mul__, "__mul__") \
+    X(__matmul__, "__matmul__") /* @ operator */ \
+    X(__truediv__, "__truediv__") \
+    X(__floordiv__, "__floordiv__") \
+    X(__mod__, "__mod__") \
+    X(__divmod__, "__divmod__") \
+    X(__pow__, "__pow__") \
+    \
+    /* Bitwise */ \
+    X(__lshift__, "__lshift__") \
+    X(__rshift__, "__rshift__") \
+    X(__and__, "__and__") \
+    X(__xor__, "__xor__") \
+    X(__or__, "__or__") \
+    \
+    /* 11. Arithmetic Operators (Reflected / Swapped) */ \
+    X(__radd__, "__radd__") \
+    X(__rsub__, "__rsub__") \
+    X(__rmul__, "__rmul__") \
+    X(__rmatmul__, "__rmatmul__") \
+    X(__rtruediv__, "__rtruediv__") \
+    X(__rfloordiv__, "__rfloordiv__") \
+    X(__rmod__, "__rmod__") \
+    X(__rdivmod__, "__rdivmod__") \
+    X(__rpow__, "__rpow__") \
+    \
+    /* Bitwise Reflected */ \
+    X(__rlshift__, "__rlshift__") \
+    X(__rrshift__, "__rrshift__") \
+    X(__rand__, "__rand__") \
+    X(__rxor__, "__rxor__") \
+    X(__ror__, "__ror__") \
+    \
+    /* 12. Arithmetic Operators (In-Place) */ \
+    X(__iadd__, "__iadd__") \
+    X(__isub__, "__isub__") \
+    X(__imul__, "__imul__") \
+    X(__imatmul__, "__imatmul__") \
+    X(__itruediv__, "__itruediv__") \
+    X(__ifloordiv__, "__ifloordiv__") \
+    X(__imod__, "__imod__") \
+    X(__ipow__, "__ipow__") \
+    \
+    /* Bitwise In-Place */ \
+    X(__ilshift__, "__ilshift__") \
+    X(__irshift__, "__irshift__") \
+    X(__iand__, "__iand__") \
+    X(__ixor__, "__ixor__") \
+    X(__ior__, "__ior__") \
+    \
+    /* 13. Unary Operators */ \
+    X(__neg__, "__neg__") \
+    X(__pos__, "__pos__") \
+    X(__abs__, "__abs__") \
+    X(__invert__, "__invert__") \
+    \
+    /* 14. Pickling, Copying & Serialization */ \
+    X(__copy__, "__copy__") \
+    X(__deepcopy__, "__deepcopy__") \
+    X(__reduce__, "__reduce__") \
+    X(__reduce_ex__, "__reduce_ex__") \
+    X(__getstate__, "__getstate__") \
+    X(__setstate__, "__setstate__") \
+    X(__getnewargs__, "__getnewargs__") \
+    X(__getnewargs_ex__, "__getnewargs_ex__") \
+    X(__sizeof__, "__sizeof__")
+
+#define NG_BUILTIN_NAME_FIELD(field, text) StringObject* field;
 typedef struct BuiltinNames {
-    StringObject* none;
-    StringObject* __typename__;
-
-    StringObject* append;
-    StringObject* pop;
-    StringObject* remove;
-    StringObject* clear;
-    StringObject* index;
-    StringObject* extend;
-    StringObject* add;
-    StringObject* discard;
-    StringObject* set_union;
-    StringObject* intersection;
-    StringObject* difference;
-    StringObject* symmetric_difference;
-    StringObject* isdisjoint;
-    StringObject* issubset;
-    StringObject* issuperset;
-    StringObject* keys;
-    StringObject* values;
-    StringObject* items;
-    StringObject* get;
-    StringObject* setdefault;
-    StringObject* popitem;
-    StringObject* update;
-    StringObject* copy;
-
-    /* -------------------------------------------------------------------------
-     * 1. Object Lifecycle & Memory Management
-     * ------------------------------------------------------------------------- */
-    StringObject* __new__;
-    StringObject* __init__;
-    StringObject* __del__;
-
-    /* -------------------------------------------------------------------------
-     * 2. String/Bytes Representation & Formatting
-     * ------------------------------------------------------------------------- */
-    StringObject* __repr__;
-    StringObject* __str__;
-    StringObject* __bytes__;
-    StringObject* __format__;
-
-    /* -------------------------------------------------------------------------
-     * 3. Comparison & Hashing
-     * ------------------------------------------------------------------------- */
-    StringObject* __hash__;
-    StringObject* __eq__;
-    StringObject* __ne__;
-    StringObject* __lt__;
-    StringObject* __le__;
-    StringObject* __gt__;
-    StringObject* __ge__;
-    
-    /* -------------------------------------------------------------------------
-     * 4. Attribute Access & Descriptors
-     * ------------------------------------------------------------------------- */
-    StringObject* __getattr__;
-    StringObject* __getattribute__;
-    StringObject* __setattr__;
-    StringObject* __delattr__;
-    StringObject* __dir__;
-
-    // Descriptors
-    StringObject* __get__;
-    StringObject* __set__;
-    StringObject* __delete__;
-    StringObject* __set_name__;
-    StringObject* __objclass__;
-    StringObject* __slots__;
-    StringObject* __dict__;
-    StringObject* __weakref__;
-
-    /* -------------------------------------------------------------------------
-     * 5. Class Structure & Imports
-     * ------------------------------------------------------------------------- */
-    StringObject* __doc__;
-    StringObject* __name__;
-    StringObject* __qualname__;
-    StringObject* __module__;
-    StringObject* __package__;
-    StringObject* __file__;
-    StringObject* __path__;
-    StringObject* __loader__;
-    StringObject* __spec__;
-    StringObject* __annotations__;
-
-    StringObject* __class__;
-    StringObject* __bases__;
-    StringObject* __mro__;
-    StringObject* __subclasses__;
-    StringObject* __init_subclass__;
-    StringObject* __class_getitem__;
-    StringObject* __mro_entries__;
-
-    /* -------------------------------------------------------------------------
-     * 6. Containers (Sequences, Mappings)
-     * ------------------------------------------------------------------------- */
-    StringObject* __len__;
-    StringObject* __length_hint__;
-    StringObject* __getitem__;
-    StringObject* __setitem__;
-    StringObject* __delitem__;
-    StringObject* __iter__;
-    StringObject* __next__;
-    StringObject* __reversed__;
-    StringObject* __contains__;
-    StringObject* __missing__;
-
-    /* -------------------------------------------------------------------------
-     * 7. Callable & Context Managers
-     * ------------------------------------------------------------------------- */
-    StringObject* __call__;
-    StringObject* __enter__;
-    StringObject* __exit__;
-
-    /* -------------------------------------------------------------------------
-     * 8. Asynchronous Programming
-     * ------------------------------------------------------------------------- */
-    StringObject* __await__;
-    StringObject* __aiter__;
-    StringObject* __anext__;
-    StringObject* __aenter__;
-    StringObject* __aexit__;
-
-    /* -------------------------------------------------------------------------
-     * 9. Numeric Types & Coercion
-     * ------------------------------------------------------------------------- */
-    StringObject* __bool__;
-    StringObject* __int__;
-    StringObject* __float__;
-    StringObject* __complex___;
-    StringObject* __index__;
-    StringObject* __round__;
-    StringObject* __trunc__;
-    StringObject* __floor__;
-    StringObject* __ceil__;
-
-    /* -------------------------------------------------------------------------
-     * 10. Arithmetic Operators (Binary)
-     * ------------------------------------------------------------------------- */
-    StringObject* __add__;
-    StringObject* __sub__;
-    StringObject* __mul__;
-    StringObject* __matmul__;       // @ operator
-    StringObject* __truediv__;
-    StringObject* __floordiv__;
-    StringObject* __mod__;
-    StringObject* __divmod__;
-    StringObject* __pow__;
-
-    // Bitwise
-    StringObject* __lshift__;
-    StringObject* __rshift__;
-    StringObject* __and__;
-    StringObject* __xor__;
-    StringObject* __or__;
-
-    /* -------------------------------------------------------------------------
-     * 11. Arithmetic Operators (Reflected / Swapped)
-     * ------------------------------------------------------------------------- */
-    StringObject* __radd__;
-    StringObject* __rsub__;
-    StringObject* __rmul__;
-    StringObject* __rmatmul__;
-    StringObject* __rtruediv__;
-    StringObject* __rfloordiv__;
-    StringObject* __rmod__;
-    StringObject* __rdivmod__;
-    StringObject* __rpow__;
-
-    // Bitwise Reflected
-    StringObject* __rlshift__;
-    StringObject* __rrshift__;
-    StringObject* __rand__;
-    StringObject* __rxor__;
-    StringObject* __ror__;
-
-    /* -------------------------------------------------------------------------
-     * 12. Arithmetic Operators (In-Place)
-     * ------------------------------------------------------------------------- */
-    StringObject* __iadd__;
-    StringObject* __isub__;
-    StringObject* __imul__;
-    StringObject* __imatmul__;
-    StringObject* __itruediv__;
-    StringObject* __ifloordiv__;
-    StringObject* __imod__;
-    StringObject* __ipow__;
-
-    // Bitwise In-Place
-    StringObject* __ilshift__;
-    StringObject* __irshift__;
-    StringObject* __iand__;
-    StringObject* __ixor__;
-    StringObject* __ior__;
-
-    /* -------------------------------------------------------------------------
-     * 13. Unary Operators
-     * ------------------------------------------------------------------------- */
-    StringObject* __neg__;
-    StringObject* __pos__;
-    StringObject* __abs__;
-    StringObject* __invert__;
-
-    /* -------------------------------------------------------------------------
-     * 14. Pickling, Copying & Serialization
-     * ------------------------------------------------------------------------- */
-    StringObject* __copy__;
-    StringObject* __deepcopy__;
-    StringObject* __reduce__;
-    StringObject* __reduce_ex__;
-    StringObject* __getstate__;
-    StringObject* __setstate__;
-    StringObject* __getnewargs__;
-    StringObject* __getnewargs_ex__;
-    StringObject* __sizeof__;
-
+    NG_BUILTIN_NAMES(NG_BUILTIN_NAME_FIELD)
 } BuiltinNames;
+#undef NG_BUILTIN_NAME_FIELD
+
+/* Layout-compatible with a kind-0 UnicodeObject: StringObject header
+ * followed immediately by NUL-terminated byte data. 32 bytes covers the
+ * longest name ("symmetric_difference", 20 chars). */
+typedef struct NgStaticName {
+    StringObject s;
+    char         data[32];
+} NgStaticName;
+
+#define NG_BUILTIN_NAME_ENTRY(field, text) { .data = text },
+static NgStaticName ng_builtin_name_data[] = {
+    NG_BUILTIN_NAMES(NG_BUILTIN_NAME_ENTRY)
+};
+#undef NG_BUILTIN_NAME_ENTRY
+#define NG_BUILTIN_NAME_COUNT (sizeof(ng_builtin_name_data) / sizeof(NgStaticName))
+
+/* * PROFILER
+ * Opt-in sampling profiler, armed by setting NAGINI_PROFILE in the
+ * environment. Generated functions push/pop their name on
+ * function_trace when profiling is active; a SIGPROF timer snapshots the
+ * trace into a fixed open-addressed bucket table (everything the handler
+ * touches is preallocated, so no allocation happens in signal context).
+ * At exit the buckets are written as folded stacks -- one
+ * "outer;inner count" line per distinct stack, the format flamegraph
+ * tooling consumes -- alongside counters that the hottest runtime entry
+ * points bump unconditionally (a single add, cheap enough to leave on).
+ */
+#define NG_PROFILE_MAX_DEPTH 32
+#define NG_PROFILE_BUCKETS   1024
+
+typedef struct NgProfileBucket {
+    uint64_t hash;
+    uint64_t count;
+    int      depth;
+    char*    frames[NG_PROFILE_MAX_DEPTH];
+} NgProfileBucket;
+
+typedef struct NgProfileState {
+    bool     active;
+    uint64_t samples;
+    uint64_t dropped;       /* bucket table full */
+    NgProfileBucket buckets[NG_PROFILE_BUCKETS];
+} NgProfileState;
+
+static void ng_profile_sample(int sig);
+static void ng_profile_dump(void);
 
 typedef struct Runtime {
     hmap_t*         symbol_table;
+    hmap_t*         slot_layouts;   /* class symbol id -> NgSlotLayout* */
+    hmap_t*         interned_strings; /* siphash of text -> immortal StringObject* */
     PoolCollection* pool;
     int64_t         trace_size;
     char*           function_trace[4096];
     uint8_t         siphash_key[16];
     BuiltinNames    builtin_names;
     Object*         classes;
-    Object*         constants[CONST_COUNT];
+    IntObject       small_ints[NG_SMALL_INT_COUNT];
+    IntObject       bool_cache[2];
+    size_t          const_count;
+    Object**        constants;
+    NgProfileState  profile;
+    Tuple*          tuple_freelist[NG_TUPLE_FREELIST_ARITIES];
+    uint32_t        tuple_freelist_depth[NG_TUPLE_FREELIST_ARITIES];
+    bool            gc_enabled;       /* NAGINI_GC set: containers are tracked */
+    bool            gc_collecting;    /* re-entrancy guard for ng_gc_collect */
+    hmap_t*         gc_tracked;       /* Object* -> Object*, containers only */
+    uint64_t        gc_alloc_count;   /* tracked allocations since last pass */
+    uint64_t        gc_threshold;     /* 0 = only explicit gc_collect() */
 } Runtime;
 
-Runtime* init_runtime() {
+/* The signal handler has no argument channel, so the profiled runtime is
+ * published through a global once profiling is armed. */
+static Runtime* ng_profile_runtime = NULL;
+
+/* Published the same way for the NAGINI_STATS atexit report; the
+ * counters themselves are always maintained, arming only adds the dump. */
+static Runtime* ng_stats_runtime = NULL;
+static void ng_stats_dump(void);
+
+/* Maintained by generated code only while profiling is active, so the
+ * common case pays a single predictable branch per call. Pushes past the
+ * trace capacity still count depth; the sampler clamps what it reads. */
+static inline void ng_trace_push(Runtime* runtime, char* name) {
+    if (runtime->trace_size < 4096) {
+        runtime->function_trace[runtime->trace_size] = name;
+    }
+    runtime->trace_size++;
+}
+
+static inline void ng_trace_pop(Runtime* runtime) {
+    if (runtime->trace_size > 0) runtime->trace_size--;
+}
+
+static void ng_profile_sample(int sig) {
+    Runtime* runtime = ng_profile_runtime;
+    if (!runtime) return;
+    NgProfileState* prof = &runtime->profile;
+
+    int64_t depth = runtime->trace_size;
+    if (depth > NG_PROFILE_MAX_DEPTH) depth = NG_PROFILE_MAX_DEPTH;
+
+    // FNV-1a over the frame pointers: the interned name pointers identify
+    // the stack, and unlike siphash this needs no key material
+    uint64_t h = 1469598103934665603ULL;
+    for (int64_t i = 0; i < depth; i++) {
+        h ^= (uint64_t)(uintptr_t) runtime->function_trace[i];
+        h *= 1099511628211ULL;
+    }
+
+    size_t idx = (size_t)(h & (NG_PROFILE_BUCKETS - 1));
+    for (int probe = 0; probe < 8; probe++) {
+        NgProfileBucket* b = &prof->buckets[(idx + probe) & (NG_PROFILE_BUCKETS - 1)];
+        if (b->count == 0) {
+            b->hash = h;
+            b->depth = (int) depth;
+            for (int64_t i = 0; i < depth; i++) {
+                b->frames[i] = runtime->function_trace[i];
+            }
+            b->count = 1;
+            prof->samples++;
+            return;
+        }
+        if (b->hash == h) {
+            b->count++;
+            prof->samples++;
+            return;
+        }
+    }
+    prof->dropped++;
+}
+
+static void ng_profile_dump(void) {
+    Runtime* runtime = ng_profile_runtime;
+    if (!runtime) return;
+    NgProfileState* prof = &runtime->profile;
+
+    const char* env = getenv("NAGINI_PROFILE");
+    const char* path = (env && strcmp(env, "1") != 0) ? env : "nagini_profile.folded";
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        fprintf(stderr, "[nagini] profile: cannot write '%s'\n", path);
+        return;
+    }
+    for (size_t i = 0; i < NG_PROFILE_BUCKETS; i++) {
+        NgProfileBucket* b = &prof->buckets[i];
+        if (b->count == 0) continue;
+        if (b->depth == 0) {
+            fprintf(out, "(main)");
+        }
+        for (int d = 0; d < b->depth; d++) {
+            fprintf(out, "%s%s", d > 0 ? ";" : "", b->frames[d]);
+        }
+        fprintf(out, " %llu\n", (unsigned long long) b->count);
+    }
+    fclose(out);
+
+    fprintf(stderr, "[nagini] profile: %llu samples (%llu dropped) -> %s\n",
+        (unsigned long long) prof->samples, (unsigned long long) prof->dropped, path);
+    fprintf(stderr, "[nagini] counters: NgCall=%llu NgGetMember=%llu dict_get=%llu pool_alloc=%llu\n",
+        (unsigned long long) ng_call_count,
+        (unsigned long long) ng_member_read_count,
+        (unsigned long long) ng_dict_lookup_count,
+        (unsigned long long) ng_pool_alloc_count);
+}
+
+/* * LAZY TRACEBACKS
+ * Error reporting reconstructs the call stack only when something actually
+ * goes wrong; the happy path maintains nothing per call. The backend emits
+ * one NgFuncInfo per generated function (address plus source-level name)
+ * and main registers the table at startup. On a fatal error,
+ * ng_print_traceback() walks the real return addresses with backtrace()
+ * and maps each one to the generated function with the greatest start
+ * address at or below it -- the usual nearest-symbol heuristic, which is
+ * as precise as the table can make it without section-size information.
+ */
+typedef struct NgFuncInfo {
+    void*       addr;
+    const char* name;
+} NgFuncInfo;
+
+NgFuncInfo* ng_function_table = NULL;
+size_t      ng_function_count = 0;
+
+static int _ng_func_info_cmp(const void* a, const void* b) {
+    uintptr_t pa = (uintptr_t)((const NgFuncInfo*)a)->addr;
+    uintptr_t pb = (uintptr_t)((const NgFuncInfo*)b)->addr;
+    return pa < pb ? -1 : (pa > pb ? 1 : 0);
+}
+
+void ng_register_functions(NgFuncInfo* table, size_t count) {
+    qsort(table, count, sizeof(NgFuncInfo), _ng_func_info_cmp);
+    ng_function_table = table;
+    ng_function_count = count;
+}
+
+void ng_print_traceback(void) {
+#if defined(__linux__)
+    if (!ng_function_table || ng_function_count == 0) return;
+    void* pcs[64];
+    int depth = backtrace(pcs, 64);
+    bool printed_header = false;
+    for (int i = 1; i < depth; i++) {
+        uintptr_t pc = (uintptr_t) pcs[i];
+        // Frames below the first generated function (runtime helpers) or
+        // absurdly far past the last one (libc) are not ours to name
+        if (pc < (uintptr_t) ng_function_table[0].addr) continue;
+        size_t lo = 0;
+        size_t hi = ng_function_count;
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if ((uintptr_t) ng_function_table[mid].addr <= pc) lo = mid; else hi = mid;
+        }
+        if (lo == ng_function_count - 1 &&
+            pc - (uintptr_t) ng_function_table[lo].addr > (1u << 20)) {
+            continue;
+        }
+        if (!printed_header) {
+            fprintf(stderr, "Traceback (most recent call first):\n");
+            printed_header = true;
+        }
+        fprintf(stderr, "  in %s\n", ng_function_table[lo].name);
+    }
+#endif
+}
+
+static void ng_crash_handler(int sig) {
+    fprintf(stderr, "Fatal signal %d\n", sig);
+    ng_print_traceback();
+    _exit(1);
+}
+
+/* * CYCLE COLLECTOR (opt-in, NAGINI_GC)
+ * Pure refcounting cannot reclaim reference cycles, so cyclic container
+ * graphs stay resident for the life of the process. Setting NAGINI_GC
+ * in the environment makes every container allocation (List, Dict, Set,
+ * instances) register itself in a side table, and gc_collect() runs a
+ * classic trial-deletion pass over it: subtract every tracked-to-tracked
+ * reference from the referee's count, mark everything reachable from
+ * objects whose count stays positive (those are held from outside the
+ * tracked graph), and tear the rest down. NAGINI_GC=<n> with n > 1
+ * additionally schedules a pass every n container allocations. When
+ * NAGINI_GC is unset the only cost is one flag test per allocation.
+ *
+ * The pass is conservative by construction: a reference the program has
+ * dropped but the generated code never DECREF'd (locals today are not
+ * released on reassignment or scope exit) keeps its referent counted as
+ * externally held, so the collector may under-collect but can never free
+ * a live object. It becomes more effective as codegen tightens its
+ * reference discipline.
+ */
+void ng_gc_track(Runtime* runtime, Object* o) {
+    if (!runtime->gc_enabled) return;
+    hmap_put(runtime->gc_tracked, (int64_t)(intptr_t)o, o);
+    if (runtime->gc_threshold &&
+        ++runtime->gc_alloc_count >= runtime->gc_threshold) {
+        runtime->gc_alloc_count = 0;
+        ng_gc_collect(runtime);
+    }
+}
+
+void ng_gc_untrack(Runtime* runtime, Object* o) {
+    if (!runtime->gc_enabled) return;
+    hmap_remove(runtime->gc_tracked, (int64_t)(intptr_t)o);
+}
+
+/* Walk the references a container holds to other objects. Tuples are not
+ * tracked (they are immutable and overwhelmingly short-lived), so cycles
+ * routed through a tuple are out of scope for the collector. */
+static void ng_gc_visit_children(Runtime* runtime, Object* o,
+                                 void (*visit)(Runtime*, Object*, void*), void* ctx) {
+    switch (o->__flags__.type) {
+        case OBJ_TYPE_LIST: {
+            List* list = (List*)o;
+            if (list->store == LIST_STORE_OBJ) {
+                for (size_t i = 0; i < list->size; i++) {
+                    if (list->items[i]) visit(runtime, list->items[i], ctx);
+                }
+            }
+            if (list->__dict__) visit(runtime, (Object*)list->__dict__, ctx);
+            break;
+        }
+        case OBJ_TYPE_DICT: {
+            Dict* d = (Dict*)o;
+            for (size_t i = 0; i < d->used; i++) {
+                if (d->entries[i].key == NULL) continue;
+                visit(runtime, d->entries[i].key, ctx);
+                if (d->entries[i].value) visit(runtime, d->entries[i].value, ctx);
+            }
+            if (d->base.__dict__) visit(runtime, (Object*)d->base.__dict__, ctx);
+            break;
+        }
+        case OBJ_TYPE_SET: {
+            Set* set = (Set*)o;
+            if (set->table) visit(runtime, (Object*)set->table, ctx);
+            if (set->base.__dict__) visit(runtime, (Object*)set->base.__dict__, ctx);
+            break;
+        }
+        case OBJ_TYPE_INSTANCE: {
+            InstanceObject* inst = (InstanceObject*)o;
+            NgSlotLayout* layout = ng_slot_layout(runtime, o->__typename__);
+            if (layout) {
+                Object** slots = NG_INSTANCE_SLOTS(inst);
+                for (size_t i = 0; i < layout->count; i++) {
+                    if (slots[i]) visit(runtime, slots[i], ctx);
+                }
+            }
+            if (inst->__dict__) visit(runtime, (Object*)inst->__dict__, ctx);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/* Drop every reference a doomed container holds, without freeing the
+ * container itself. Cycle members are kept alive by an extra reference
+ * during teardown, so the DECREFs here are ordinary ones. */
+static void ng_gc_clear(Runtime* runtime, Object* o) {
+    switch (o->__flags__.type) {
+        case OBJ_TYPE_LIST: {
+            List* list = (List*)o;
+            if (list->store == LIST_STORE_OBJ) {
+                for (size_t i = 0; i < list->size; i++) {
+                    DECREF(runtime, list->items[i]);
+                }
+            }
+            list->size = 0;
+            if (list->__dict__) { DECREF(runtime, list->__dict__); list->__dict__ = NULL; }
+            break;
+        }
+        case OBJ_TYPE_DICT: {
+            Dict* d = (Dict*)o;
+            for (size_t i = 0; i < d->used; i++) {
+                if (d->entries[i].key == NULL) continue;
+                DECREF(runtime, d->entries[i].key);
+                DECREF(runtime, d->entries[i].value);
+                d->entries[i].key = NULL;
+                d->entries[i].value = NULL;
+            }
+            ng_dict_live_entries -= d->count;
+            d->used = 0;
+            d->count = 0;
+            memset(d->index, 0xFF, d->capacity * sizeof(int32_t));
+            d->version++;
+            if (d->base.__dict__) { DECREF(runtime, d->base.__dict__); d->base.__dict__ = NULL; }
+            break;
+        }
+        case OBJ_TYPE_SET: {
+            Set* set = (Set*)o;
+            if (set->table) { DECREF(runtime, (Object*)set->table); set->table = NULL; }
+            if (set->base.__dict__) { DECREF(runtime, set->base.__dict__); set->base.__dict__ = NULL; }
+            break;
+        }
+        case OBJ_TYPE_INSTANCE: {
+            InstanceObject* inst = (InstanceObject*)o;
+            NgSlotLayout* layout = ng_slot_layout(runtime, o->__typename__);
+            if (layout) {
+                Object** slots = NG_INSTANCE_SLOTS(inst);
+                for (size_t i = 0; i < layout->count; i++) {
+                    if (slots[i]) { DECREF(runtime, slots[i]); slots[i] = NULL; }
+                }
+            }
+            if (inst->__dict__) { DECREF(runtime, inst->__dict__); inst->__dict__ = NULL; }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+typedef struct NgGcPass {
+    /* Trial refcounts, biased by one so a count of zero still stores a
+     * non-NULL value; marking removes an entry, so whatever is left at
+     * the end is unreachable. */
+    hmap_t*  refs;
+    Object** stack;
+    size_t   stack_top;
+} NgGcPass;
+
+static void _ng_gc_subtract(Runtime* runtime, Object* child, void* ctx) {
+    (void)runtime;
+    NgGcPass* pass = (NgGcPass*)ctx;
+    int64_t key = (int64_t)(intptr_t)child;
+    void* v = hmap_get(pass->refs, key);
+    if (v && (intptr_t)v > 1) {
+        hmap_put(pass->refs, key, (void*)((intptr_t)v - 1));
+    }
+}
+
+static void _ng_gc_mark_child(Runtime* runtime, Object* child, void* ctx) {
+    (void)runtime;
+    NgGcPass* pass = (NgGcPass*)ctx;
+    int64_t key = (int64_t)(intptr_t)child;
+    if (!hmap_get(pass->refs, key)) return; /* untracked or already marked */
+    hmap_remove(pass->refs, key);
+    pass->stack[pass->stack_top++] = child;
+}
+
+size_t ng_gc_collect(Runtime* runtime) {
+    if (!runtime->gc_enabled || runtime->gc_collecting) return 0;
+    runtime->gc_collecting = true;
+
+    hmap_t* tracked = runtime->gc_tracked;
+    _hmap_migrate_finish(tracked);
+    size_t n = 0;
+    Object** objs = (Object**) malloc(tracked->count * sizeof(Object*));
+    for (size_t i = 0; i < tracked->capacity && n < tracked->count; i++) {
+        if (tracked->ctrl[i] < HMAP_CTRL_EMPTY) {
+            objs[n++] = (Object*) tracked->entries[i].value;
+        }
+    }
+    if (n == 0) {
+        free(objs);
+        runtime->gc_collecting = false;
+        return 0;
+    }
+
+    NgGcPass pass;
+    pass.refs = hmap_create();
+    pass.stack = (Object**) malloc(n * sizeof(Object*));
+    pass.stack_top = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        hmap_put(pass.refs, (int64_t)(intptr_t)objs[i],
+                 (void*)((intptr_t)objs[i]->__refcount__ + 1));
+    }
+    for (size_t i = 0; i < n; i++) {
+        ng_gc_visit_children(runtime, objs[i], _ng_gc_subtract, &pass);
+    }
+    // Objects whose count survives the subtraction are held from outside
+    // the tracked graph; everything reachable from them is alive
+    for (size_t i = 0; i < n; i++) {
+        int64_t key = (int64_t)(intptr_t)objs[i];
+        void* v = hmap_get(pass.refs, key);
+        if (v && (intptr_t)v > 1) {
+            hmap_remove(pass.refs, key);
+            pass.stack[pass.stack_top++] = objs[i];
+        }
+    }
+    while (pass.stack_top > 0) {
+        Object* o = pass.stack[--pass.stack_top];
+        ng_gc_visit_children(runtime, o, _ng_gc_mark_child, &pass);
+    }
+
+    // Whatever was never marked is cyclic garbage. Pin each member, break
+    // every edge, then drop the pins; the members then die through the
+    // ordinary DECREF paths.
+    size_t dead = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (hmap_get(pass.refs, (int64_t)(intptr_t)objs[i])) {
+            objs[dead++] = objs[i];
+        }
+    }
+    for (size_t i = 0; i < dead; i++) INCREF(runtime, objs[i]);
+    for (size_t i = 0; i < dead; i++) ng_gc_clear(runtime, objs[i]);
+    for (size_t i = 0; i < dead; i++) DECREF(runtime, objs[i]);
+
+    hmap_destroy(pass.refs);
+    free(pass.stack);
+    free(objs);
+    runtime->gc_collecting = false;
+    return dead;
+}
+
+/* gc_collect() builtin: run one collection pass now. Returns the number
+ * of container objects freed (always 0 unless NAGINI_GC is set). */
+Object* NgGcCollect(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)args;
+    (void)kwargs;
+    return alloc_int(runtime, (int64_t) ng_gc_collect(runtime));
+}
+
+/* Preallocate the small-int and bool caches. These live inside the
+ * Runtime itself and are immortal: alloc_int() hands them out without
+ * touching the pools and INCREF/DECREF leave them alone. Shared between
+ * init_runtime and the per-thread shards spawn() creates. */
+static void ng_init_scalar_caches(Runtime* runtime) {
+    int32_t int_symbol  = get_symbol_id(runtime, "int");
+    int32_t bool_symbol = get_symbol_id(runtime, "bool");
+    for (int i = 0; i < NG_SMALL_INT_COUNT; i++) {
+        IntObject* obj = &runtime->small_ints[i];
+        memset(obj, 0, sizeof(IntObject));
+        obj->base.__typename__ = int_symbol;
+        obj->base.__refcount__ = NG_IMMORTAL_REFCOUNT;
+        obj->base.__flags__.type = OBJ_TYPE_INT;
+        obj->__value__ = NG_SMALL_INT_MIN + i;
+    }
+    for (int i = 0; i < 2; i++) {
+        IntObject* obj = &runtime->bool_cache[i];
+        memset(obj, 0, sizeof(IntObject));
+        obj->base.__typename__ = bool_symbol;
+        obj->base.__refcount__ = NG_IMMORTAL_REFCOUNT;
+        obj->base.__flags__.type = OBJ_TYPE_INT;
+        obj->base.__flags__.boolean = i;
+        obj->__value__ = i;
+    }
+}
+
+Runtime* init_runtime(size_t const_count) {
     Runtime* runtime = (Runtime*) malloc(sizeof(Runtime));  // Use global runtime directly
+    runtime->const_count = const_count;
+    runtime->constants = (Object**) calloc(const_count, sizeof(Object*));
     runtime->symbol_table = hmap_create();
+    runtime->slot_layouts = hmap_create();
+    runtime->interned_strings = hmap_create();
     runtime->pool = (PoolCollection*) malloc(sizeof(PoolCollection));
 
     // Initialize dynamic pools for different object types
@@ -1432,11 +2328,28 @@ Runtime* init_runtime() {
     runtime->pool->set = dynamic_pool_create(sizeof(Set), 256);
     runtime->pool->functions = dynamic_pool_create(sizeof(Function), 512);
     
-    size_t block_sizes[64] = { 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128, 144, 160, 176, 192, 208, 224, 240, 256, 272, 288, 304, 320, 336, 352, 368, 384, 416, 448, 480, 512, 576, 640, 704, 768, 832, 896, 960, 1024, 1152, 1280, 1408, 1536, 1664, 1792, 1920, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304, 8388608 };
-    size_t block_prpge[64] = { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 16, 16, 16, 16, 16, 16, 16, 16, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
-
-    for (int i = 0; i < 64; i++) {
-        runtime->pool->powers_of_two[i] = dynamic_pool_create(block_sizes[i], block_prpge[i]);
+    // The 64 size-class pools are created on first use by alloc(); a
+    // typical program only ever touches a handful of the classes, so
+    // startup builds none of them (tables: ng_pool_block_sizes)
+    memset(runtime->pool->powers_of_two, 0, sizeof(runtime->pool->powers_of_two));
+
+    memset(runtime->tuple_freelist, 0, sizeof(runtime->tuple_freelist));
+    memset(runtime->tuple_freelist_depth, 0, sizeof(runtime->tuple_freelist_depth));
+
+    // Opt-in cycle collector (see CYCLE COLLECTOR). NAGINI_GC turns on
+    // container tracking; a value above 1 also schedules a pass every
+    // that many container allocations.
+    runtime->gc_enabled = false;
+    runtime->gc_collecting = false;
+    runtime->gc_tracked = NULL;
+    runtime->gc_alloc_count = 0;
+    runtime->gc_threshold = 0;
+    const char* gc_env = getenv("NAGINI_GC");
+    if (gc_env && gc_env[0] && strcmp(gc_env, "0") != 0) {
+        runtime->gc_enabled = true;
+        runtime->gc_tracked = hmap_create();
+        long long gc_every = atoll(gc_env);
+        if (gc_every > 1) runtime->gc_threshold = (uint64_t) gc_every;
     }
 
     runtime->trace_size = 0;
@@ -1444,227 +2357,105 @@ Runtime* init_runtime() {
     // Generate a random SIPHASH key
     siphash_random_key(runtime->siphash_key);
 
-    runtime->builtin_names.none  = (StringObject*) alloc_str(runtime, "None");
-    runtime->builtin_names.__typename__ = (StringObject*) alloc_str(runtime, "__typename__");
-
-    runtime->builtin_names.append = (StringObject*) alloc_str(runtime, "append");
-    runtime->builtin_names.pop    = (StringObject*) alloc_str(runtime, "pop");
-    runtime->builtin_names.remove = (StringObject*) alloc_str(runtime, "remove");
-    runtime->builtin_names.clear  = (StringObject*) alloc_str(runtime, "clear");
-    runtime->builtin_names.index  = (StringObject*) alloc_str(runtime, "index");
-    runtime->builtin_names.extend = (StringObject*) alloc_str(runtime, "extend");
-    runtime->builtin_names.add    = (StringObject*) alloc_str(runtime, "add");
-    runtime->builtin_names.discard = (StringObject*) alloc_str(runtime, "discard");
-    runtime->builtin_names.set_union = (StringObject*) alloc_str(runtime, "union");
-    runtime->builtin_names.intersection = (StringObject*) alloc_str(runtime, "intersection");
-    runtime->builtin_names.difference = (StringObject*) alloc_str(runtime, "difference");
-    runtime->builtin_names.symmetric_difference = (StringObject*) alloc_str(runtime, "symmetric_difference");
-    runtime->builtin_names.isdisjoint = (StringObject*) alloc_str(runtime, "isdisjoint");
-    runtime->builtin_names.issubset = (StringObject*) alloc_str(runtime, "issubset");
-    runtime->builtin_names.issuperset = (StringObject*) alloc_str(runtime, "issuperset");
-    runtime->builtin_names.keys   = (StringObject*) alloc_str(runtime, "keys");
-    runtime->builtin_names.values = (StringObject*) alloc_str(runtime, "values");
-    runtime->builtin_names.items  = (StringObject*) alloc_str(runtime, "items");
-    runtime->builtin_names.get    = (StringObject*) alloc_str(runtime, "get");
-    runtime->builtin_names.setdefault = (StringObject*) alloc_str(runtime, "setdefault");
-    runtime->builtin_names.popitem = (StringObject*) alloc_str(runtime, "popitem");
-    runtime->builtin_names.update = (StringObject*) alloc_str(runtime, "update");
-    runtime->builtin_names.copy = (StringObject*) alloc_str(runtime, "copy");
-
-    // -------------------------------------------------------------------------
-    // 1. Object Lifecycle & Memory Management
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__new__  = (StringObject*) alloc_str(runtime, "__new__");
-    runtime->builtin_names.__init__ = (StringObject*) alloc_str(runtime, "__init__");
-    runtime->builtin_names.__del__  = (StringObject*) alloc_str(runtime, "__del__");
-
-    // -------------------------------------------------------------------------
-    // 2. String/Bytes Representation & Formatting
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__repr__   = (StringObject*) alloc_str(runtime, "__repr__");
-    runtime->builtin_names.__str__    = (StringObject*) alloc_str(runtime, "__str__");
-    runtime->builtin_names.__bytes__  = (StringObject*) alloc_str(runtime, "__bytes__");
-    runtime->builtin_names.__format__ = (StringObject*) alloc_str(runtime, "__format__");
-
-    // -------------------------------------------------------------------------
-    // 3. Comparison & Hashing
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__hash__ = (StringObject*) alloc_str(runtime, "__hash__");
-    runtime->builtin_names.__eq__   = (StringObject*) alloc_str(runtime, "__eq__");
-    runtime->builtin_names.__ne__   = (StringObject*) alloc_str(runtime, "__ne__");
-    runtime->builtin_names.__lt__   = (StringObject*) alloc_str(runtime, "__lt__");
-    runtime->builtin_names.__le__   = (StringObject*) alloc_str(runtime, "__le__");
-    runtime->builtin_names.__gt__   = (StringObject*) alloc_str(runtime, "__gt__");
-    runtime->builtin_names.__ge__   = (StringObject*) alloc_str(runtime, "__ge__");
-
-    // -------------------------------------------------------------------------
-    // 4. Attribute Access & Descriptors
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__getattr__      = (StringObject*) alloc_str(runtime, "__getattr__");
-    runtime->builtin_names.__getattribute__ = (StringObject*) alloc_str(runtime, "__getattribute__");
-    runtime->builtin_names.__setattr__      = (StringObject*) alloc_str(runtime, "__setattr__");
-    runtime->builtin_names.__delattr__      = (StringObject*) alloc_str(runtime, "__delattr__");
-    runtime->builtin_names.__dir__          = (StringObject*) alloc_str(runtime, "__dir__");
-    
-    // Descriptors
-    runtime->builtin_names.__get__      = (StringObject*) alloc_str(runtime, "__get__");
-    runtime->builtin_names.__set__      = (StringObject*) alloc_str(runtime, "__set__");
-    runtime->builtin_names.__delete__   = (StringObject*) alloc_str(runtime, "__delete__");
-    runtime->builtin_names.__set_name__ = (StringObject*) alloc_str(runtime, "__set_name__");
-    runtime->builtin_names.__objclass__ = (StringObject*) alloc_str(runtime, "__objclass__");
-    runtime->builtin_names.__slots__    = (StringObject*) alloc_str(runtime, "__slots__");
-    runtime->builtin_names.__dict__     = (StringObject*) alloc_str(runtime, "__dict__");
-    runtime->builtin_names.__weakref__  = (StringObject*) alloc_str(runtime, "__weakref__");
-
-    // -------------------------------------------------------------------------
-    // 5. Class Structure & Imports
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__doc__         = (StringObject*) alloc_str(runtime, "__doc__");
-    runtime->builtin_names.__name__        = (StringObject*) alloc_str(runtime, "__name__");
-    runtime->builtin_names.__qualname__    = (StringObject*) alloc_str(runtime, "__qualname__");
-    runtime->builtin_names.__module__      = (StringObject*) alloc_str(runtime, "__module__");
-    runtime->builtin_names.__package__     = (StringObject*) alloc_str(runtime, "__package__");
-    runtime->builtin_names.__file__        = (StringObject*) alloc_str(runtime, "__file__");
-    runtime->builtin_names.__path__        = (StringObject*) alloc_str(runtime, "__path__");
-    runtime->builtin_names.__loader__      = (StringObject*) alloc_str(runtime, "__loader__");
-    runtime->builtin_names.__spec__        = (StringObject*) alloc_str(runtime, "__spec__");
-    runtime->builtin_names.__annotations__ = (StringObject*) alloc_str(runtime, "__annotations__");
-
-    runtime->builtin_names.__class__         = (StringObject*) alloc_str(runtime, "__class__");
-    runtime->builtin_names.__bases__         = (StringObject*) alloc_str(runtime, "__bases__");
-    runtime->builtin_names.__mro__           = (StringObject*) alloc_str(runtime, "__mro__");
-    runtime->builtin_names.__subclasses__    = (StringObject*) alloc_str(runtime, "__subclasses__");
-    runtime->builtin_names.__init_subclass__ = (StringObject*) alloc_str(runtime, "__init_subclass__");
-    runtime->builtin_names.__class_getitem__ = (StringObject*) alloc_str(runtime, "__class_getitem__");
-    runtime->builtin_names.__mro_entries__   = (StringObject*) alloc_str(runtime, "__mro_entries__");
-
-    // -------------------------------------------------------------------------
-    // 6. Containers (Sequences, Mappings)
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__len__         = (StringObject*) alloc_str(runtime, "__len__");
-    runtime->builtin_names.__length_hint__ = (StringObject*) alloc_str(runtime, "__length_hint__");
-    runtime->builtin_names.__getitem__     = (StringObject*) alloc_str(runtime, "__getitem__");
-    runtime->builtin_names.__setitem__     = (StringObject*) alloc_str(runtime, "__setitem__");
-    runtime->builtin_names.__delitem__     = (StringObject*) alloc_str(runtime, "__delitem__");
-    runtime->builtin_names.__iter__        = (StringObject*) alloc_str(runtime, "__iter__");
-    runtime->builtin_names.__next__        = (StringObject*) alloc_str(runtime, "__next__");
-    runtime->builtin_names.__reversed__    = (StringObject*) alloc_str(runtime, "__reversed__");
-    runtime->builtin_names.__contains__    = (StringObject*) alloc_str(runtime, "__contains__");
-    runtime->builtin_names.__missing__     = (StringObject*) alloc_str(runtime, "__missing__");
-
-    // -------------------------------------------------------------------------
-    // 7. Callable & Context Managers
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__call__  = (StringObject*) alloc_str(runtime, "__call__");
-    runtime->builtin_names.__enter__ = (StringObject*) alloc_str(runtime, "__enter__");
-    runtime->builtin_names.__exit__  = (StringObject*) alloc_str(runtime, "__exit__");
-
-    // -------------------------------------------------------------------------
-    // 8. Asynchronous Programming
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__await__  = (StringObject*) alloc_str(runtime, "__await__");
-    runtime->builtin_names.__aiter__  = (StringObject*) alloc_str(runtime, "__aiter__");
-    runtime->builtin_names.__anext__  = (StringObject*) alloc_str(runtime, "__anext__");
-    runtime->builtin_names.__aenter__ = (StringObject*) alloc_str(runtime, "__aenter__");
-    runtime->builtin_names.__aexit__  = (StringObject*) alloc_str(runtime, "__aexit__");
-
-    // -------------------------------------------------------------------------
-    // 9. Numeric Types & Coercion
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__bool__    = (StringObject*) alloc_str(runtime, "__bool__");
-    runtime->builtin_names.__int__     = (StringObject*) alloc_str(runtime, "__int__");
-    runtime->builtin_names.__float__   = (StringObject*) alloc_str(runtime, "__float__");
-    runtime->builtin_names.__complex___= (StringObject*) alloc_str(runtime, "__complex__");
-    runtime->builtin_names.__index__   = (StringObject*) alloc_str(runtime, "__index__");
-    runtime->builtin_names.__round__   = (StringObject*) alloc_str(runtime, "__round__");
-    runtime->builtin_names.__trunc__   = (StringObject*) alloc_str(runtime, "__trunc__");
-    runtime->builtin_names.__floor__   = (StringObject*) alloc_str(runtime, "__floor__");
-    runtime->builtin_names.__ceil__    = (StringObject*) alloc_str(runtime, "__ceil__");
-
-    // -------------------------------------------------------------------------
-    // 10. Arithmetic Operators (Binary)
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__add__      = (StringObject*) alloc_str(runtime, "__add__");
-    runtime->builtin_names.__sub__      = (StringObject*) alloc_str(runtime, "__sub__");
-    runtime->builtin_names.__mul__      = (StringObject*) alloc_str(runtime, "__mul__");
-    runtime->builtin_names.__matmul__   = (StringObject*) alloc_str(runtime, "__matmul__");
-    runtime->builtin_names.__truediv__  = (StringObject*) alloc_str(runtime, "__truediv__");
-    runtime->builtin_names.__floordiv__ = (StringObject*) alloc_str(runtime, "__floordiv__");
-    runtime->builtin_names.__mod__      = (StringObject*) alloc_str(runtime, "__mod__");
-    runtime->builtin_names.__divmod__   = (StringObject*) alloc_str(runtime, "__divmod__");
-    runtime->builtin_names.__pow__      = (StringObject*) alloc_str(runtime, "__pow__");
-
-    // Bitwise
-    runtime->builtin_names.__lshift__ = (StringObject*) alloc_str(runtime, "__lshift__");
-    runtime->builtin_names.__rshift__ = (StringObject*) alloc_str(runtime, "__rshift__");
-    runtime->builtin_names.__and__    = (StringObject*) alloc_str(runtime, "__and__");
-    runtime->builtin_names.__xor__    = (StringObject*) alloc_str(runtime, "__xor__");
-    runtime->builtin_names.__or__     = (StringObject*) alloc_str(runtime, "__or__");
-
-    // -------------------------------------------------------------------------
-    // 11. Arithmetic Operators (Reflected / Swapped)
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__radd__      = (StringObject*) alloc_str(runtime, "__radd__");
-    runtime->builtin_names.__rsub__      = (StringObject*) alloc_str(runtime, "__rsub__");
-    runtime->builtin_names.__rmul__      = (StringObject*) alloc_str(runtime, "__rmul__");
-    runtime->builtin_names.__rmatmul__   = (StringObject*) alloc_str(runtime, "__rmatmul__");
-    runtime->builtin_names.__rtruediv__  = (StringObject*) alloc_str(runtime, "__rtruediv__");
-    runtime->builtin_names.__rfloordiv__ = (StringObject*) alloc_str(runtime, "__rfloordiv__");
-    runtime->builtin_names.__rmod__      = (StringObject*) alloc_str(runtime, "__rmod__");
-    runtime->builtin_names.__rdivmod__   = (StringObject*) alloc_str(runtime, "__rdivmod__");
-    runtime->builtin_names.__rpow__      = (StringObject*) alloc_str(runtime, "__rpow__");
-
-    // Bitwise Reflected
-    runtime->builtin_names.__rlshift__ = (StringObject*) alloc_str(runtime, "__rlshift__");
-    runtime->builtin_names.__rrshift__ = (StringObject*) alloc_str(runtime, "__rrshift__");
-    runtime->builtin_names.__rand__    = (StringObject*) alloc_str(runtime, "__rand__");
-    runtime->builtin_names.__rxor__    = (StringObject*) alloc_str(runtime, "__rxor__");
-    runtime->builtin_names.__ror__     = (StringObject*) alloc_str(runtime, "__ror__");
-
-    // -------------------------------------------------------------------------
-    // 12. Arithmetic Operators (In-Place)
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__iadd__      = (StringObject*) alloc_str(runtime, "__iadd__");
-    runtime->builtin_names.__isub__      = (StringObject*) alloc_str(runtime, "__isub__");
-    runtime->builtin_names.__imul__      = (StringObject*) alloc_str(runtime, "__imul__");
-    runtime->builtin_names.__imatmul__   = (StringObject*) alloc_str(runtime, "__imatmul__");
-    runtime->builtin_names.__itruediv__  = (StringObject*) alloc_str(runtime, "__itruediv__");
-    runtime->builtin_names.__ifloordiv__ = (StringObject*) alloc_str(runtime, "__ifloordiv__");
-    runtime->builtin_names.__imod__      = (StringObject*) alloc_str(runtime, "__imod__");
-    runtime->builtin_names.__ipow__      = (StringObject*) alloc_str(runtime, "__ipow__");
-
-    // Bitwise In-Place
-    runtime->builtin_names.__ilshift__ = (StringObject*) alloc_str(runtime, "__ilshift__");
-    runtime->builtin_names.__irshift__ = (StringObject*) alloc_str(runtime, "__irshift__");
-    runtime->builtin_names.__iand__    = (StringObject*) alloc_str(runtime, "__iand__");
-    runtime->builtin_names.__ixor__    = (StringObject*) alloc_str(runtime, "__ixor__");
-    runtime->builtin_names.__ior__     = (StringObject*) alloc_str(runtime, "__ior__");
-
-    // -------------------------------------------------------------------------
-    // 13. Unary Operators
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__neg__    = (StringObject*) alloc_str(runtime, "__neg__");
-    runtime->builtin_names.__pos__    = (StringObject*) alloc_str(runtime, "__pos__");
-    runtime->builtin_names.__abs__    = (StringObject*) alloc_str(runtime, "__abs__");
-    runtime->builtin_names.__invert__ = (StringObject*) alloc_str(runtime, "__invert__");
-
-    // -------------------------------------------------------------------------
-    // 14. Pickling, Copying & Serialization
-    // -------------------------------------------------------------------------
-    runtime->builtin_names.__copy__         = (StringObject*) alloc_str(runtime, "__copy__");
-    runtime->builtin_names.__deepcopy__     = (StringObject*) alloc_str(runtime, "__deepcopy__");
-    runtime->builtin_names.__reduce__       = (StringObject*) alloc_str(runtime, "__reduce__");
-    runtime->builtin_names.__reduce_ex__    = (StringObject*) alloc_str(runtime, "__reduce_ex__");
-    runtime->builtin_names.__getstate__     = (StringObject*) alloc_str(runtime, "__getstate__");
-    runtime->builtin_names.__setstate__     = (StringObject*) alloc_str(runtime, "__setstate__");
-    runtime->builtin_names.__getnewargs__   = (StringObject*) alloc_str(runtime, "__getnewargs__");
-    runtime->builtin_names.__getnewargs_ex__= (StringObject*) alloc_str(runtime, "__getnewargs_ex__");
-    runtime->builtin_names.__sizeof__       = (StringObject*) alloc_str(runtime, "__sizeof__");
+#if defined(__linux__)
+    // Crash paths reconstruct the stack lazily from return addresses;
+    // nothing is maintained per call for error reporting
+    signal(SIGSEGV, ng_crash_handler);
+    signal(SIGABRT, ng_crash_handler);
+#endif
+
+    memset(&runtime->profile, 0, sizeof(NgProfileState));
+    const char* profile_env = getenv("NAGINI_PROFILE");
+    if (profile_env && profile_env[0] && strcmp(profile_env, "0") != 0) {
+#if defined(__linux__)
+        runtime->profile.active = true;
+        ng_profile_runtime = runtime;
+
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = ng_profile_sample;
+        sa.sa_flags = SA_RESTART;
+        sigaction(SIGPROF, &sa, NULL);
+
+        // ITIMER_PROF counts CPU time, so an idle process takes no samples
+        struct itimerval timer;
+        timer.it_interval.tv_sec = 0;
+        timer.it_interval.tv_usec = 1000;
+        timer.it_value = timer.it_interval;
+        setitimer(ITIMER_PROF, &timer, NULL);
+
+        atexit(ng_profile_dump);
+#else
+        fprintf(stderr, "[nagini] NAGINI_PROFILE is only supported on Linux\n");
+#endif
+    }
+
+    // Opt-in stats report (see RUNTIME STATISTICS). The counters behind
+    // it are always on; NAGINI_STATS only registers the exit dump.
+    const char* stats_env = getenv("NAGINI_STATS");
+    if (stats_env && stats_env[0] && strcmp(stats_env, "0") != 0) {
+        ng_stats_runtime = runtime;
+        atexit(ng_stats_dump);
+    }
+
+    ng_init_scalar_caches(runtime);
+
+    // Builtin name objects are static data; one startup pass stamps
+    // their hashes and interns them (see STATIC BUILTIN NAMES)
+    ng_init_builtin_names(runtime);
 
     runtime->classes = (Object*) alloc_dict(runtime);
     return runtime;
 }
 
+/* Called by generated main once every runtime->constants[] entry is
+ * registered. Constants live for the whole process, so making them
+ * immortal exempts them from refcount traffic -- and it is what lets
+ * spawn() shards share the table: strings and cached small ints are
+ * born immortal, but float/large-int constants, function objects and
+ * class objects start at refcount 1, and a worker INCREF/DECREFing a
+ * non-atomic count on one of those races the other threads. */
+void ng_immortalize_constants(Runtime* runtime) {
+    for (size_t i = 0; i < runtime->const_count; i++) {
+        Object* c = runtime->constants[i];
+        if (c) c->__refcount__ = NG_IMMORTAL_REFCOUNT;
+    }
+}
+
+/* NgTrimMemory() / NgTrimMemory(keep_pages)
+ * Releases fully-empty pool pages back to the OS across every pool in
+ * the runtime's PoolCollection, keeping `keep_pages` empty pages per
+ * pool (default 1) warm for the next allocation burst. Intended for
+ * long-running programs after a transient spike - e.g. driven by an RSS
+ * threshold - since the pools otherwise never shrink. Returns the
+ * number of pages released.
+ */
+Object* NgTrimMemory(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)kwargs;
+    size_t keep_pages = 1;
+    if (args && args->size > 0) {
+        int64_t requested = NgCastToInt(runtime, args->items[0]);
+        keep_pages = requested > 0 ? (size_t)requested : 0;
+    }
+
+    PoolCollection* pools = runtime->pool;
+    size_t freed = 0;
+    freed += dynamic_pool_trim(pools->base, keep_pages);
+    freed += dynamic_pool_trim(pools->instance, keep_pages);
+    freed += dynamic_pool_trim(pools->ints, keep_pages);
+    freed += dynamic_pool_trim(pools->floats, keep_pages);
+    freed += dynamic_pool_trim(pools->list, keep_pages);
+    freed += dynamic_pool_trim(pools->dict, keep_pages);
+    freed += dynamic_pool_trim(pools->set, keep_pages);
+    freed += dynamic_pool_trim(pools->functions, keep_pages);
+    for (int i = 0; i < 64; i++) {
+        if (pools->powers_of_two[i]) {
+            freed += dynamic_pool_trim(pools->powers_of_two[i], keep_pages);
+        }
+    }
+    return alloc_int(runtime, (int64_t)freed);
+}
+
 Object* NgLen(Runtime* runtime, Tuple* args, Dict* kwargs) {
     if (!args) {
         fprintf(stderr, "TypeError: len() missing 1 required positional argument: 'obj'\n");
@@ -1694,6 +2485,11 @@ Object* NgLen(Runtime* runtime, Tuple* args, Dict* kwargs) {
             length = str->size;
             break;
         }
+        case OBJ_TYPE_BYTES: {
+            BytesObject* bytes = (BytesObject*)obj;
+            length = bytes->size;
+            break;
+        }
         case OBJ_TYPE_DICT: {
             Dict* dict = (Dict*)obj;
             length = dict->count;
@@ -1709,6 +2505,10 @@ Object* NgLen(Runtime* runtime, Tuple* args, Dict* kwargs) {
             if (view->dict) length = view->dict->count;
             break;
         }
+        case OBJ_TYPE_BUFFER: {
+            length = ng_buffer_count(runtime, obj);
+            break;
+        }
         default: {
             Object* len_method = NgGetMember(runtime, obj, runtime->builtin_names.__len__);
             if (!len_method) {
@@ -1726,19 +2526,89 @@ Object* NgLen(Runtime* runtime, Tuple* args, Dict* kwargs) {
     return alloc_int(runtime, (int64_t) length);
 }
 
-Object* NgToString(Runtime* runtime, void* obj) {
-    Object* o = (Object*)obj;
+/* * Growable string builder
+ * Replaces the fixed 64K-256K scratch buffers and strncat chains that made
+ * concatenation and container repr O(n^2). Small results stay in the inline
+ * buffer; larger ones grow through the pool allocator with amortized
+ * doubling and are finalized exactly once into a UnicodeObject.
+ */
+#define NG_SB_INLINE 256
+
+typedef struct NgStrBuilder {
+    char*  data;
+    size_t len;
+    size_t cap;
+    bool   is_manual;
+    int    pool_id;
+    char   inline_buf[NG_SB_INLINE];
+} NgStrBuilder;
+
+void ng_sb_init(NgStrBuilder* sb) {
+    sb->data = sb->inline_buf;
+    sb->len = 0;
+    sb->cap = NG_SB_INLINE;
+    sb->data[0] = '\0';
+}
 
-    switch (o->__flags__.type) {
-        case OBJ_TYPE_INT: {
-            IntObject* int_obj = (IntObject*)o;
-            char buffer[131072];
-            snprintf(buffer, sizeof(buffer), "%lld", (long long)int_obj->__value__);
-            return alloc_str(runtime, buffer);
+void ng_sb_append(Runtime* runtime, NgStrBuilder* sb, const char* s, size_t n) {
+    if (sb->len + n + 1 > sb->cap) {
+        size_t new_cap = sb->cap * 2;
+        while (new_cap < sb->len + n + 1) new_cap *= 2;
+        bool is_manual = false;
+        int pool_id = 0;
+        char* grown = (char*) alloc(runtime, new_cap, &is_manual, &pool_id, false);
+        if (!grown) {
+            fprintf(stderr, "MemoryError\n");
+            exit(1);
         }
-        case OBJ_TYPE_FLOAT: {
-            FloatObject* float_obj = (FloatObject*)o;
-            char buffer[131072];
+        memcpy(grown, sb->data, sb->len);
+        if (sb->data != sb->inline_buf) {
+            del(runtime, sb->data, sb->is_manual, sb->pool_id);
+        }
+        sb->data = grown;
+        sb->cap = new_cap;
+        sb->is_manual = is_manual;
+        sb->pool_id = pool_id;
+    }
+    memcpy(sb->data + sb->len, s, n);
+    sb->len += n;
+    sb->data[sb->len] = '\0';
+}
+
+void ng_sb_append_cstr(Runtime* runtime, NgStrBuilder* sb, const char* s) {
+    ng_sb_append(runtime, sb, s, strlen(s));
+}
+
+/* Finalize into a string object and release the growable buffer */
+Object* ng_sb_finish(Runtime* runtime, NgStrBuilder* sb) {
+    Object* result = alloc_str(runtime, sb->data);
+    if (sb->data != sb->inline_buf) {
+        del(runtime, sb->data, sb->is_manual, sb->pool_id);
+    }
+    return result;
+}
+
+/* Append one element repr, quoting strings like the container cases do */
+static void _ng_sb_append_repr(Runtime* runtime, NgStrBuilder* sb, Object* item) {
+    bool is_str = item && item->__flags__.type == OBJ_TYPE_STRING;
+    if (is_str) ng_sb_append(runtime, sb, "\"", 1);
+    ng_sb_append_cstr(runtime, sb, NgToCString(runtime, item));
+    if (is_str) ng_sb_append(runtime, sb, "\"", 1);
+}
+
+Object* NgToString(Runtime* runtime, void* obj) {
+    Object* o = (Object*)obj;
+
+    switch (o->__flags__.type) {
+        case OBJ_TYPE_INT: {
+            IntObject* int_obj = (IntObject*)o;
+            char buffer[131072];
+            snprintf(buffer, sizeof(buffer), "%lld", (long long)int_obj->__value__);
+            return alloc_str(runtime, buffer);
+        }
+        case OBJ_TYPE_FLOAT: {
+            FloatObject* float_obj = (FloatObject*)o;
+            char buffer[131072];
             snprintf(buffer, sizeof(buffer), "%f", float_obj->__value__);
             return alloc_str(runtime, buffer);
         }
@@ -1754,80 +2624,47 @@ Object* NgToString(Runtime* runtime, void* obj) {
         }
         case OBJ_TYPE_TUPLE: {
             Tuple* tuple = (Tuple*)o;
-            char buffer[262144];
-            memset(buffer, 0, sizeof(buffer));
-            buffer[0] = '(';
-            buffer[1] = '\0';
-            char* quote = "\"";
+            NgStrBuilder sb;
+            ng_sb_init(&sb);
+            ng_sb_append(runtime, &sb, "(", 1);
             for (size_t i = 0; i < tuple->size; i++) {
-                Object* item = tuple->items[i];
-                const char* item_cstr = NgToCString(runtime, item);
-                size_t len = strlen(item_cstr);
-                bool is_str = item && item->__flags__.type == OBJ_TYPE_STRING;
-                if (i > 0) {
-                    strncat(buffer, ", ", sizeof(buffer) - strlen(buffer) - 1);
-                }
-                if (is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
-                strncat(buffer, item_cstr, sizeof(buffer) - strlen(buffer) - 1);
-                if (is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
+                if (i > 0) ng_sb_append(runtime, &sb, ", ", 2);
+                _ng_sb_append_repr(runtime, &sb, tuple->items[i]);
             }
-            size_t end = strlen(buffer);
-            buffer[end] = ')';
-            buffer[end + 1] = '\0';
-            return alloc_str(runtime, buffer);
+            ng_sb_append(runtime, &sb, ")", 1);
+            return ng_sb_finish(runtime, &sb);
         }
         case OBJ_TYPE_LIST: {
             List* list = (List*)o;
-            char buffer[262144];
-            memset(buffer, 0, sizeof(buffer));
-            buffer[0] = '[';
-            buffer[1] = '\0';
-            char* quote = "\"";
+            NgStrBuilder sb;
+            ng_sb_init(&sb);
+            ng_sb_append(runtime, &sb, "[", 1);
+            list_spill_to_objects(runtime, list);
             for (size_t i = 0; i < list->size; i++) {
-                Object* item = list->items[i];
-                const char* item_cstr = NgToCString(runtime, item);
-                size_t len = strlen(item_cstr);
-                bool is_str = item && item->__flags__.type == OBJ_TYPE_STRING;
-                if (i > 0) {
-                    strncat(buffer, ", ", sizeof(buffer) - strlen(buffer) - 1);
-                }
-                if (is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
-                strncat(buffer, item_cstr, sizeof(buffer) - strlen(buffer) - 1);
-                if (is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
+                if (i > 0) ng_sb_append(runtime, &sb, ", ", 2);
+                _ng_sb_append_repr(runtime, &sb, list->items[i]);
             }
-            size_t end = strlen(buffer);
-            buffer[end] = ']';
-            buffer[end + 1] = '\0';
-            return alloc_str(runtime, buffer);
+            ng_sb_append(runtime, &sb, "]", 1);
+            return ng_sb_finish(runtime, &sb);
         }
         case OBJ_TYPE_SET: {
             Set* set = (Set*)o;
-            char buffer[262144];
-            memset(buffer, 0, sizeof(buffer));
-            buffer[0] = '{';
-            buffer[1] = '\0';
-            char* quote = "\"";
+            NgStrBuilder sb;
+            ng_sb_init(&sb);
+            ng_sb_append(runtime, &sb, "{", 1);
             size_t added = 0;
             Dict* table = set->table;
             if (table) {
-                for (size_t i = 0; i < table->capacity; i++) {
+                for (size_t i = 0; i < table->used; i++) {
                     dict_entry_t* entry = &table->entries[i];
-                    if (entry->psl == 0) continue;
-                    const char* item_cstr = NgToCString(runtime, entry->key);
-                    bool is_str = entry->key && entry->key->__flags__.type == OBJ_TYPE_STRING;
-                    if (added > 0) {
-                        strncat(buffer, ", ", sizeof(buffer) - strlen(buffer) - 1);
-                    }
-                    if (is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
-                    strncat(buffer, item_cstr, sizeof(buffer) - strlen(buffer) - 1);
-                    if (is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
+                    if (entry->key == NULL) continue;
+                    if (added > 0) ng_sb_append(runtime, &sb, ", ", 2);
+                    _ng_sb_append_repr(runtime, &sb, entry->key);
                     added++;
                 }
             }
-            size_t end = strlen(buffer);
-            buffer[end] = '}';
-            buffer[end + 1] = '\0';
-            return alloc_str(runtime, buffer);
+            ng_sb_append(runtime, &sb, "}", 1);
+            return ng_sb_finish(runtime, &sb);
         }
         case OBJ_TYPE_INSTANCE: {
             InstanceObject* instance = (InstanceObject*)o;
@@ -1846,7 +2683,7 @@ Object* NgToString(Runtime* runtime, void* obj) {
                 }
                 //  else {
                 //     printf("No __str__ method on instance of '%s'\n", obj_type_name(o));
-                //     for (size_t i = 0; i < dict->capacity; i++) {
+                //     for (size_t i = 0; i < dict->used; i++) {
                 //         if (dict->entries[i].key == NULL) continue;
                 //         const char* key_str = NgToCString(runtime, dict->entries[i].key);
                 //         printf("Dict slot %zu: key '%i'\n", i, hash(runtime, dict->entries[i].key));
@@ -1900,34 +2737,26 @@ Object* NgToString(Runtime* runtime, void* obj) {
 
         case OBJ_TYPE_DICT: {
             Dict* dict = (Dict*)o;
-            char buffer[262144];
-            memset(buffer, 0, sizeof(buffer));
-            buffer[0] = '{';
-            buffer[1] = '\0';
-            char* quote = "\"";
+            NgStrBuilder sb;
+            ng_sb_init(&sb);
+            ng_sb_append(runtime, &sb, "{", 1);
             size_t added = 0;
-            for (size_t i = 0; i < dict->capacity; i++) {
+            for (size_t i = 0; i < dict->used; i++) {
                 if (dict->entries[i].key == NULL) continue;
-                Object* key = dict->entries[i].key;
-                Object* value = dict->entries[i].value;
-                const char* key_cstr = NgToCString(runtime, key);
-                const char* value_cstr = NgToCString(runtime, value);
-                bool key_is_str = key && key->__flags__.type == OBJ_TYPE_STRING;
-                bool value_is_str = value && value->__flags__.type == OBJ_TYPE_STRING;
-                if (added > 0) {
-                    strncat(buffer, ", ", sizeof(buffer) - strlen(buffer) - 1);
-                }
-                if (key_is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
-                strncat(buffer, key_cstr, sizeof(buffer) - strlen(buffer) - 1);
-                if (key_is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
-                strncat(buffer, ": ", sizeof(buffer) - strlen(buffer) - 1);
-                if (value_is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
-                strncat(buffer, value_cstr, sizeof(buffer) - strlen(buffer) - 1);
-                if (value_is_str) strncat(buffer, quote, sizeof(buffer) - strlen(buffer) - 1);
+                if (added > 0) ng_sb_append(runtime, &sb, ", ", 2);
+                _ng_sb_append_repr(runtime, &sb, dict->entries[i].key);
+                ng_sb_append(runtime, &sb, ": ", 2);
+                _ng_sb_append_repr(runtime, &sb, dict->entries[i].value);
                 added++;
             }
-            buffer[strlen(buffer)] = '}';
-            buffer[strlen(buffer) + 1] = '\0';
+            ng_sb_append(runtime, &sb, "}", 1);
+            return ng_sb_finish(runtime, &sb);
+        }
+        case OBJ_TYPE_BUFFER: {
+            BufferObject* buf = (BufferObject*)o;
+            char buffer[64];
+            snprintf(buffer, sizeof(buffer), "<buffer of %zu elements>",
+                buf->elem_size ? buf->size / buf->elem_size : (size_t)0);
             return alloc_str(runtime, buffer);
         }
         default:
@@ -2055,13 +2884,59 @@ int32_t get_symbol_id(Runtime* runtime, const char* name) {
     return key;
 }
 
+/* Size-class tables for the general allocator. The pool for a class is
+ * created on first allocation in that class, so startup builds no pool
+ * it will never use. */
+static const size_t ng_pool_block_sizes[64] = { 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128, 144, 160, 176, 192, 208, 224, 240, 256, 272, 288, 304, 320, 336, 352, 368, 384, 416, 448, 480, 512, 576, 640, 704, 768, 832, 896, 960, 1024, 1152, 1280, 1408, 1536, 1664, 1792, 1920, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304, 8388608 };
+static const size_t ng_pool_blocks_per_page[64] = { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 32, 32, 32, 32, 16, 16, 16, 16, 16, 16, 16, 16, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+
+/* * LARGE ALLOCATIONS
+ * Buffers at or above NG_MMAP_THRESHOLD bypass the pools and come straight
+ * from mmap. The top size classes (256KB-8MB) would otherwise be served by
+ * pools whose pages are themselves multi-megabyte malloc blocks: wasteful
+ * when only one block is live, and TLB-hostile because the kernel cannot
+ * back glibc heap memory with huge pages reliably. A dedicated anonymous
+ * mapping per buffer lets us ask for transparent huge pages (MADV_HUGEPAGE)
+ * and return the memory to the OS immediately on release.
+ *
+ * Tracking reuses the existing allocation bits: the manual path always
+ * stores pool_id 0, so is_manual=1 together with pool_id NG_MMAP_POOL_ID
+ * uniquely marks an mmap block. The mapped length is stashed in a 16-byte
+ * header in front of the payload (16 keeps the payload's malloc-style
+ * alignment) so del() knows how much to munmap.
+ */
+#define NG_MMAP_THRESHOLD (256 * 1024)
+#define NG_MMAP_POOL_ID   63
+#define NG_MMAP_HEADER    16
+
 /* Allocate memory from a pool or manually */
 void* alloc(Runtime* runtime, size_t size, bool* is_manual, int* pool_id, bool zeroed) {
     if (!runtime || !runtime->pool) return NULL;
 
+#if defined(__linux__)
+    if (size >= NG_MMAP_THRESHOLD) {
+        size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+        size_t total = (size + NG_MMAP_HEADER + page_size - 1) & ~(page_size - 1);
+        void* base = mmap(NULL, total, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+            madvise(base, total, MADV_HUGEPAGE);
+#endif
+            *((size_t*)base) = total;
+            *is_manual = true;
+            *pool_id = NG_MMAP_POOL_ID;
+            ng_alloc_mmap_count++;
+            // Fresh anonymous mappings are already zero-filled
+            return (uint8_t*)base + NG_MMAP_HEADER;
+        }
+        // mmap failure (e.g. vm.max_map_count): fall back to the pools
+    }
+#endif
+
     int id = -1;
     for (int i = 0; i < 64; i++) {
-        if (size <= runtime->pool->powers_of_two[i]->block_payload_size) {
+        if (size <= ng_pool_block_sizes[i]) {
             id = i;
             break;
         }
@@ -2070,6 +2945,7 @@ void* alloc(Runtime* runtime, size_t size, bool* is_manual, int* pool_id, bool z
     if (id == -1) {
         *is_manual = true;
         *pool_id = 0;
+        ng_alloc_large_count++;
         void* ptr = malloc(size);
         if (zeroed) memset(ptr, 0, size);
         return ptr;
@@ -2077,8 +2953,14 @@ void* alloc(Runtime* runtime, size_t size, bool* is_manual, int* pool_id, bool z
 
     *is_manual = false;
     *pool_id = id;
+    ng_alloc_class_count[id]++;
 
-    void* ptr = dynamic_pool_alloc(runtime->pool->powers_of_two[id]);
+    dynamic_pool_t* pool = runtime->pool->powers_of_two[id];
+    if (!pool) {
+        pool = dynamic_pool_create(ng_pool_block_sizes[id], ng_pool_blocks_per_page[id]);
+        runtime->pool->powers_of_two[id] = pool;
+    }
+    void* ptr = dynamic_pool_alloc(pool);
     if (zeroed) memset(ptr, 0, size);
     return ptr;
 }
@@ -2086,6 +2968,13 @@ void* alloc(Runtime* runtime, size_t size, bool* is_manual, int* pool_id, bool z
 /* Free memory from a pool or manually */
 void del(Runtime* runtime, void* ptr, bool is_manual, int pool_id) {
     if (is_manual) {
+#if defined(__linux__)
+        if (pool_id == NG_MMAP_POOL_ID) {
+            uint8_t* base = (uint8_t*)ptr - NG_MMAP_HEADER;
+            munmap(base, *((size_t*)base));
+            return;
+        }
+#endif
         free(ptr);
     } else {
         if (pool_id >= 0 && pool_id < 64) {
@@ -2094,6 +2983,124 @@ void del(Runtime* runtime, void* ptr, bool is_manual, int pool_id) {
     }
 }
 
+/* * RUNTIME STATISTICS
+ * runtime_stats() at the language level returns a dict of allocator,
+ * dict and refcount telemetry; NAGINI_STATS=1 prints the same numbers
+ * (plus a per-pool breakdown) to stderr at exit. The counters feeding
+ * this are the unconditional thread-local adds declared next to the
+ * profiler counters - cheap enough to leave on in production - while
+ * the pool occupancy figures are computed on demand by walking the page
+ * lists under each pool's lock, so only the report pays for them.
+ */
+static void _ng_pool_totals(PoolCollection* pools, uint64_t* total_pages,
+                            uint64_t* total_high, uint64_t* total_in_use,
+                            uint64_t* total_capacity) {
+    dynamic_pool_t* named[] = {
+        pools->base, pools->instance, pools->ints, pools->floats,
+        pools->list, pools->dict, pools->set, pools->functions,
+    };
+    *total_pages = 0;
+    *total_high = 0;
+    *total_in_use = 0;
+    *total_capacity = 0;
+    size_t pages, high, in_use, capacity;
+    for (size_t i = 0; i < sizeof(named) / sizeof(named[0]); i++) {
+        dynamic_pool_stats(named[i], &pages, &high, &in_use, &capacity);
+        *total_pages += pages;
+        *total_high += high;
+        *total_in_use += in_use;
+        *total_capacity += capacity;
+    }
+    for (int i = 0; i < 64; i++) {
+        if (!pools->powers_of_two[i]) continue;
+        dynamic_pool_stats(pools->powers_of_two[i], &pages, &high, &in_use, &capacity);
+        *total_pages += pages;
+        *total_high += high;
+        *total_in_use += in_use;
+        *total_capacity += capacity;
+    }
+}
+
+Object* NgRuntimeStats(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)args;
+    (void)kwargs;
+
+    uint64_t pages, high, in_use, capacity;
+    _ng_pool_totals(runtime->pool, &pages, &high, &in_use, &capacity);
+
+    Dict* stats = (Dict*) alloc_dict(runtime);
+#define NG_STAT(name, value) \
+    dict_set(runtime, stats, alloc_str_interned(runtime, name), alloc_int(runtime, (int64_t)(value)))
+    NG_STAT("pool_pages", pages);
+    NG_STAT("pool_pages_high_water", high);
+    NG_STAT("pool_blocks_in_use", in_use);
+    NG_STAT("pool_blocks_capacity", capacity);
+    NG_STAT("alloc_pool", ng_pool_alloc_count);
+    NG_STAT("alloc_large", ng_alloc_large_count);
+    NG_STAT("alloc_mmap", ng_alloc_mmap_count);
+    NG_STAT("incref", ng_incref_count);
+    NG_STAT("decref", ng_decref_count);
+    NG_STAT("calls", ng_call_count);
+    NG_STAT("member_reads", ng_member_read_count);
+    NG_STAT("dict_lookups", ng_dict_lookup_count);
+    NG_STAT("dict_probes", ng_dict_probe_count);
+    NG_STAT("dict_probe_max", ng_dict_probe_max);
+    NG_STAT("dicts_live", ng_dict_live_count);
+    NG_STAT("dict_entries", ng_dict_live_entries);
+    NG_STAT("dict_index_slots", ng_dict_index_slots);
+#undef NG_STAT
+    return (Object*)stats;
+}
+
+static void _ng_stats_dump_pool(const char* label, dynamic_pool_t* pool, uint64_t allocs) {
+    size_t pages, high, in_use, capacity;
+    dynamic_pool_stats(pool, &pages, &high, &in_use, &capacity);
+    if (pages == 0 && allocs == 0) return;
+    fprintf(stderr, "[nagini]   pool %-10s pages=%zu (high %zu) blocks=%zu/%zu allocs=%llu\n",
+        label, pages, high, in_use, capacity, (unsigned long long) allocs);
+}
+
+static void ng_stats_dump(void) {
+    Runtime* runtime = ng_stats_runtime;
+    if (!runtime || !runtime->pool) return;
+    PoolCollection* pools = runtime->pool;
+
+    fprintf(stderr, "[nagini] runtime stats:\n");
+    _ng_stats_dump_pool("base", pools->base, 0);
+    _ng_stats_dump_pool("instance", pools->instance, 0);
+    _ng_stats_dump_pool("ints", pools->ints, 0);
+    _ng_stats_dump_pool("floats", pools->floats, 0);
+    _ng_stats_dump_pool("list", pools->list, 0);
+    _ng_stats_dump_pool("dict", pools->dict, 0);
+    _ng_stats_dump_pool("set", pools->set, 0);
+    _ng_stats_dump_pool("functions", pools->functions, 0);
+    for (int i = 0; i < 64; i++) {
+        if (!pools->powers_of_two[i] && ng_alloc_class_count[i] == 0) continue;
+        char label[32];
+        snprintf(label, sizeof(label), "%zuB", ng_pool_block_sizes[i]);
+        _ng_stats_dump_pool(label, pools->powers_of_two[i], ng_alloc_class_count[i]);
+    }
+    fprintf(stderr, "[nagini]   alloc: pool=%llu large=%llu mmap=%llu\n",
+        (unsigned long long) ng_pool_alloc_count,
+        (unsigned long long) ng_alloc_large_count,
+        (unsigned long long) ng_alloc_mmap_count);
+    double load = ng_dict_index_slots
+        ? (double) ng_dict_live_entries / (double) ng_dict_index_slots : 0.0;
+    double probes = ng_dict_lookup_count
+        ? (double) ng_dict_probe_count / (double) ng_dict_lookup_count : 0.0;
+    fprintf(stderr, "[nagini]   dicts: live=%llu entries=%llu index_slots=%llu "
+        "load=%.2f probes/lookup=%.2f max_probe=%llu\n",
+        (unsigned long long) ng_dict_live_count,
+        (unsigned long long) ng_dict_live_entries,
+        (unsigned long long) ng_dict_index_slots,
+        load, probes, (unsigned long long) ng_dict_probe_max);
+    fprintf(stderr, "[nagini]   refcounts: incref=%llu decref=%llu calls=%llu member_reads=%llu\n",
+        (unsigned long long) ng_incref_count,
+        (unsigned long long) ng_decref_count,
+        (unsigned long long) ng_call_count,
+        (unsigned long long) ng_member_read_count);
+}
+
 void NgGetTypeName(Runtime* runtime, void* oo, char* buffer, size_t size) {
     Object* obj = (Object*)oo;
     switch (obj->__flags__.type) {
@@ -2129,8 +3136,10 @@ void NgGetTypeName(Runtime* runtime, void* oo, char* buffer, size_t size) {
 
 /* Call a function object */
 inline Object* NgCall(Runtime* runtime, void* ffunc, void* aargs, void* kkwargs) {
+    ng_call_count++;
     if (!ffunc) {
         fprintf(stderr, "Runtime Error: Attempting to call NULL function\n");
+        ng_print_traceback();
         exit(1);
     }
     Function* func = (Function*)ffunc;
@@ -2267,6 +3276,12 @@ Object* NgIterNext(Runtime* runtime, void* iter) {
         case ITER_KIND_LIST: {
             List* list = (List*)it->iterable;
             if (it->index >= list->size) return NULL;
+            if (list->store == LIST_STORE_I64) {
+                return alloc_int(runtime, ((int64_t*)list->items)[it->index++]);
+            }
+            if (list->store == LIST_STORE_F64) {
+                return alloc_float(runtime, ((double*)list->items)[it->index++]);
+            }
             return INCREF(runtime, list->items[it->index++]);
         }
         case ITER_KIND_TUPLE: {
@@ -2284,9 +3299,9 @@ Object* NgIterNext(Runtime* runtime, void* iter) {
                 dict = ((ViewObject*)it->iterable)->dict;
             }
             if (!dict) return NULL;
-            while (it->index < dict->capacity) {
+            while (it->index < dict->used) {
                 dict_entry_t* entry = &dict->entries[it->index++];
-                if (entry->psl == 0) continue;
+                if (entry->key == NULL) continue;
                 if (it->iter_kind == ITER_KIND_DICT_KEYS) {
                     return INCREF(runtime, entry->key);
                 } else if (it->iter_kind == ITER_KIND_DICT_VALUES) {
@@ -2303,9 +3318,9 @@ Object* NgIterNext(Runtime* runtime, void* iter) {
             Set* set = (Set*)it->iterable;
             Dict* table = set->table;
             if (!table) return NULL;
-            while (it->index < table->capacity) {
+            while (it->index < table->used) {
                 dict_entry_t* entry = &table->entries[it->index++];
-                if (entry->psl == 0) continue;
+                if (entry->key == NULL) continue;
                 return INCREF(runtime, entry->key);
             }
             return NULL;
@@ -2321,6 +3336,7 @@ Object* NgContains(Runtime* runtime, void* container, void* item) {
     switch (obj->__flags__.type) {
         case OBJ_TYPE_LIST: {
             List* list = (List*)obj;
+            list_spill_to_objects(runtime, list);
             for (size_t i = 0; i < list->size; i++) {
                 if (ObjectsEqual(runtime, list->items[i], (Object*)item) || list->items[i] == item) {
                     return alloc_bool(runtime, true);
@@ -2416,8 +3432,8 @@ Object* NgDictFromIterable(Runtime* runtime, void* iterable) {
     if (obj->__flags__.type == OBJ_TYPE_DICT) {
         Dict* src = (Dict*)obj;
         Dict* dest = alloc_dict(runtime);
-        for (size_t i = 0; i < src->capacity; i++) {
-            if (src->entries[i].psl > 0) {
+        for (size_t i = 0; i < src->used; i++) {
+            if (src->entries[i].key != NULL) {
                 dict_set(runtime, dest, src->entries[i].key, src->entries[i].value);
             }
         }
@@ -2506,10 +3522,12 @@ Object* NgDictPopItem(Runtime* runtime, Tuple* args, Dict* kwargs) {
         exit(1);
     }
     Dict* d = (Dict*)args->items[0];
-    for (size_t i = 0; i < d->capacity; i++) {
-        if (d->entries[i].psl > 0) {
-            Object* key = d->entries[i].key;
-            Object* value = d->entries[i].value;
+    // Entries are kept in insertion order, so pop from the tail to return
+    // the most recently inserted pair.
+    for (size_t i = d->used; i > 0; i--) {
+        if (d->entries[i - 1].key != NULL) {
+            Object* key = d->entries[i - 1].key;
+            Object* value = d->entries[i - 1].value;
             Object* tup_items[2] = { key, value };
             Object* result = alloc_tuple(runtime, 2, tup_items);
             dict_del(runtime, d, key);
@@ -2526,16 +3544,19 @@ Object* NgDictClear(Runtime* runtime, Tuple* args, Dict* kwargs) {
         exit(1);
     }
     Dict* d = (Dict*)args->items[0];
-    for (size_t i = 0; i < d->capacity; i++) {
-        if (d->entries[i].psl > 0) {
+    for (size_t i = 0; i < d->used; i++) {
+        if (d->entries[i].key != NULL) {
             DECREF(runtime, d->entries[i].key);
             DECREF(runtime, d->entries[i].value);
-            d->entries[i].psl = 0;
             d->entries[i].key = NULL;
             d->entries[i].value = NULL;
         }
     }
+    ng_dict_live_entries -= d->count;
+    d->used = 0;
     d->count = 0;
+    memset(d->index, 0xFF, d->capacity * sizeof(int32_t));
+    d->version++;
     return (Object*) runtime->builtin_names.none;
 }
 
@@ -2551,8 +3572,8 @@ Object* NgDictUpdate(Runtime* runtime, Tuple* args, Dict* kwargs) {
         exit(1);
     }
     Dict* od = (Dict*)other;
-    for (size_t i = 0; i < od->capacity; i++) {
-        if (od->entries[i].psl > 0) {
+    for (size_t i = 0; i < od->used; i++) {
+        if (od->entries[i].key != NULL) {
             dict_set(runtime, d, od->entries[i].key, od->entries[i].value);
         }
     }
@@ -2581,20 +3602,39 @@ static Dict* alloc_dict_internal(Runtime* runtime, bool add_methods) {
     d->base.__dict__ = NULL;
     
     d->capacity = DICT_INITIAL_CAPACITY;
+    d->used = 0;
     d->count = 0;
     d->mask = d->capacity - 1;
-    d->threshold = (d->capacity * DICT_LOAD_FACTOR) / 100;
-    
+    d->threshold = (d->capacity * 2) / 3;
+    if (d->threshold == 0) d->threshold = 1;
+    d->version = 0;
+
+    // The dense array only ever holds `threshold` slots: growth (or
+    // tombstone compaction) runs before `used` can pass it
     bool is_manual = false;
     int pool_id = 0;
-    d->entries = (dict_entry_t*) alloc(runtime, d->capacity * sizeof(dict_entry_t), &is_manual, &pool_id, true);
+    d->entries = (dict_entry_t*) alloc(runtime, d->threshold * sizeof(dict_entry_t), &is_manual, &pool_id, true);
     d->__allocation__.is_manual = is_manual ? 1 : 0;
     d->__allocation__.pool_id = pool_id;
     if (!d->entries) {
         dynamic_pool_free(runtime->pool->dict, d);
         return NULL;
     }
-    
+    d->index = (int32_t*) alloc(runtime, d->capacity * sizeof(int32_t), &is_manual, &pool_id, false);
+    d->__index_allocation__.is_manual = is_manual ? 1 : 0;
+    d->__index_allocation__.pool_id = pool_id;
+    if (!d->index) {
+        del(runtime, d->entries, d->__allocation__.is_manual == 1, d->__allocation__.pool_id);
+        dynamic_pool_free(runtime->pool->dict, d);
+        return NULL;
+    }
+    memset(d->index, 0xFF, d->capacity * sizeof(int32_t));  // all DICT_IX_EMPTY
+
+    ng_dict_live_count++;
+    ng_dict_index_slots += d->capacity;
+
+    ng_gc_track(runtime, (Object*)d);
+
     if (add_methods) {
         return (Dict*)add_dict_functions(runtime, d);
     }
@@ -2607,51 +3647,65 @@ Dict* alloc_dict(Runtime* runtime) {
 
 
 
-static bool _dict_resize(Runtime* runtime, Dict* d, size_t new_capacity) {
-    dict_entry_t* old_entries = d->entries;
-    size_t old_capacity = d->capacity;
+/* Insert an entry position into a probe table known to contain neither
+ * the key nor any tombstone (freshly rebuilt index): the first empty
+ * slot on the probe sequence is always correct. */
+static void _dict_index_insert(int32_t* index, size_t mask, int64_t h, size_t pos) {
+    size_t slot = (size_t)h & mask;
+    while (index[slot] != DICT_IX_EMPTY) {
+        slot = (slot + 1) & mask;
+    }
+    index[slot] = (int32_t)pos;
+}
+
+/* Grow the index table (or just compact tombstones when new_capacity
+ * equals the current one). The live entries are copied densely in
+ * insertion order - iteration order is preserved by construction - and
+ * the index is rebuilt from their cached hashes without touching a
+ * single key or value object. */
+static bool _dict_grow(Runtime* runtime, Dict* d, size_t new_capacity) {
+    size_t new_threshold = (new_capacity * 2) / 3;
+    if (new_threshold == 0) new_threshold = 1;
 
     bool is_manual = false;
     int pool_id = 0;
-    dict_entry_t* new_entries = (dict_entry_t*) alloc(runtime, new_capacity * sizeof(dict_entry_t), &is_manual, &pool_id, true);
+    dict_entry_t* new_entries = (dict_entry_t*) alloc(runtime, new_threshold * sizeof(dict_entry_t), &is_manual, &pool_id, false);
     if (!new_entries) return false;
+    int entries_is_manual = is_manual ? 1 : 0;
+    int entries_pool_id = pool_id;
 
-    int old_is_manual = d->__allocation__.is_manual;
-    int old_pool_id = d->__allocation__.pool_id;
-
-    d->entries = new_entries;
-    d->capacity = new_capacity;
-    d->mask = new_capacity - 1;
-    d->threshold = (new_capacity * DICT_LOAD_FACTOR) / 100;
-    d->count = 0;
+    int32_t* new_index = (int32_t*) alloc(runtime, new_capacity * sizeof(int32_t), &is_manual, &pool_id, false);
+    if (!new_index) {
+        del(runtime, new_entries, entries_is_manual == 1, entries_pool_id);
+        return false;
+    }
+    memset(new_index, 0xFF, new_capacity * sizeof(int32_t));
 
-    for (size_t i = 0; i < old_capacity; ++i) {
-        if (old_entries[i].psl > 0) {
-            dict_entry_t entry = old_entries[i];
-            entry.psl = 1;
-            
-            size_t idx = (size_t)entry.hash & d->mask;
-            
-            while (true) {
-                if (d->entries[idx].psl == 0) {
-                    d->entries[idx] = entry;
-                    d->count++;
-                    break;
-                }
-                
-                if (entry.psl > d->entries[idx].psl) {
-                    dict_entry_t temp = d->entries[idx];
-                    d->entries[idx] = entry;
-                    entry = temp;
-                }
-                
-                idx = (idx + 1) & d->mask;
-                entry.psl++;
-            }
-        }
+    size_t mask = new_capacity - 1;
+    size_t pos = 0;
+    for (size_t i = 0; i < d->used; i++) {
+        if (d->entries[i].key == NULL) continue;
+        new_entries[pos] = d->entries[i];
+        _dict_index_insert(new_index, mask, new_entries[pos].hash, pos);
+        pos++;
     }
 
-    del(runtime, old_entries, old_is_manual == 1, old_pool_id);
+    del(runtime, d->entries, d->__allocation__.is_manual == 1, d->__allocation__.pool_id);
+    del(runtime, d->index, d->__index_allocation__.is_manual == 1, d->__index_allocation__.pool_id);
+
+    ng_dict_index_slots += new_capacity - d->capacity;
+
+    d->entries = new_entries;
+    d->index = new_index;
+    d->capacity = new_capacity;
+    d->mask = mask;
+    d->threshold = new_threshold;
+    d->used = pos;
+    d->version++;
+    d->__allocation__.is_manual = entries_is_manual;
+    d->__allocation__.pool_id = entries_pool_id;
+    d->__index_allocation__.is_manual = is_manual ? 1 : 0;
+    d->__index_allocation__.pool_id = pool_id;
     return true;
 }
 
@@ -2720,114 +3774,151 @@ int dict_set(Runtime* runtime, void* dd, void* kk, void* vv) {
     Object* key = (Object*)kk;
     Object* value = (Object*)vv;
 
-    if (d->count >= d->threshold) {
-        if (!_dict_resize(runtime, d, d->capacity * 2)) return -1;
+    if (d->used >= d->threshold) {
+        // Mostly live: double the index. Mostly tombstones: same size,
+        // the rebuild just compacts them away.
+        size_t new_capacity = (d->count * 2 >= d->threshold) ? d->capacity * 2 : d->capacity;
+        if (!_dict_grow(runtime, d, new_capacity)) return -1;
     }
 
     int64_t h = hash(runtime, key);
-    size_t idx = (size_t)h & d->mask;
-    uint32_t psl = 1;
-
-    dict_entry_t entry = { .key = key, .value = value, .hash = h, .psl = psl };
+    size_t slot = (size_t)h & d->mask;
+    size_t insert_slot = SIZE_MAX;  // first tombstone on the probe path
 
     while (true) {
-        dict_entry_t* curr = &d->entries[idx];
-
-        if (curr->psl == 0) { // key not found, insert here
-            *curr = entry;
-            d->count++;
-            INCREF(runtime, key);
-            INCREF(runtime, value);
-            return 0;
+        int32_t ix = d->index[slot];
+        if (ix == DICT_IX_EMPTY) {
+            if (insert_slot == SIZE_MAX) insert_slot = slot;
+            break;
         }
-
-        if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) { // key found, update value
-            if (curr->value != value) {
-                if (curr->value) DECREF(runtime, curr->value);
-                curr->value = value;
-                INCREF(runtime, value);
+        if (ix == DICT_IX_DELETED) {
+            if (insert_slot == SIZE_MAX) insert_slot = slot;
+        } else {
+            dict_entry_t* curr = &d->entries[ix];
+            if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) {
+                if (curr->value != value) {  // key found, update value
+                    if (curr->value) DECREF(runtime, curr->value);
+                    curr->value = value;
+                    INCREF(runtime, value);
+                }
+                return 0;
             }
-            return 0;
         }
-
-        if (entry.psl > curr->psl) { // Robin Hood swapping, continue probing
-            dict_entry_t temp = *curr;
-            *curr = entry;
-            entry = temp;
-        }
-
-        idx = (idx + 1) & d->mask;
-        entry.psl++;
-    }
+        slot = (slot + 1) & d->mask;
+    }
+
+    // Key not found: append to the dense log
+    d->index[insert_slot] = (int32_t)d->used;
+    d->entries[d->used].key = key;
+    d->entries[d->used].value = value;
+    d->entries[d->used].hash = h;
+    d->used++;
+    d->count++;
+    d->version++;
+    ng_dict_live_entries++;
+    INCREF(runtime, key);
+    INCREF(runtime, value);
+    return 0;
 }
 
 Object* dict_get(Runtime* runtime, void* dd, void* kk) {
     Dict* d = (Dict*)dd;
+    ng_dict_lookup_count++;
     if (!d) return NULL;  // Add NULL check
     Object* key = (Object*)kk;
 
     int64_t h = hash(runtime, key);
-    size_t idx = (size_t)h & d->mask;
-    uint32_t psl = 1;
+    size_t slot = (size_t)h & d->mask;
+    uint64_t probes = 0;
 
     while (true) {
-        dict_entry_t* curr = &d->entries[idx];
-
-        if (curr->psl == 0) return NULL;
-
-        if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) {
-            return curr->value;
+        probes++;
+        int32_t ix = d->index[slot];
+        if (ix == DICT_IX_EMPTY) break;
+        if (ix != DICT_IX_DELETED) {
+            dict_entry_t* curr = &d->entries[ix];
+            if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) {
+                ng_dict_probe_count += probes;
+                if (probes > ng_dict_probe_max) ng_dict_probe_max = probes;
+                return curr->value;
+            }
         }
+        slot = (slot + 1) & d->mask;
+    }
+    ng_dict_probe_count += probes;
+    if (probes > ng_dict_probe_max) ng_dict_probe_max = probes;
+    return NULL;
+}
 
-        if (curr->psl < psl) return NULL;
+/* Slot layout registry (fixed-offset attribute storage for compiled classes) */
 
-        idx = (idx + 1) & d->mask;
-        psl++;
+void ng_register_slot_layout(Runtime* runtime, const char* class_name, size_t count, Object** names) {
+    NgSlotLayout* layout = (NgSlotLayout*) malloc(sizeof(NgSlotLayout) + count * sizeof(Object*));
+    if (!layout) {
+        fprintf(stderr, "Runtime Error: Failed to allocate slot layout for class '%s'\n", class_name);
+        exit(1);
     }
+    layout->count = count;
+    layout->names = (Object**)(layout + 1);
+    memcpy(layout->names, names, count * sizeof(Object*));
+    hmap_put(runtime->slot_layouts, (int64_t) get_symbol_id(runtime, class_name), layout);
 }
 
-bool dict_del(Runtime* runtime, void* dd, void* kk) {
+NgSlotLayout* ng_slot_layout(Runtime* runtime, int32_t typename_id) {
+    return (NgSlotLayout*) hmap_get(runtime->slot_layouts, (int64_t) typename_id);
+}
+
+/* Like dict_get, but returns the entry slot so callers (inline caches) can
+ * remember where the key lives. */
+dict_entry_t* dict_get_entry(Runtime* runtime, void* dd, void* kk) {
     Dict* d = (Dict*)dd;
-    if (!d) return false;  // Add NULL check
+    if (!d) return NULL;
     Object* key = (Object*)kk;
 
     int64_t h = hash(runtime, key);
-    size_t idx = (size_t)h & d->mask;
-    uint32_t psl = 1;
+    size_t slot = (size_t)h & d->mask;
 
     while (true) {
-        dict_entry_t* curr = &d->entries[idx];
-
-        if (curr->psl == 0 || psl > curr->psl) return false;
+        int32_t ix = d->index[slot];
+        if (ix == DICT_IX_EMPTY) return NULL;
+        if (ix != DICT_IX_DELETED) {
+            dict_entry_t* curr = &d->entries[ix];
+            if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) {
+                return curr;
+            }
+        }
+        slot = (slot + 1) & d->mask;
+    }
+}
 
-        if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) {
-            d->count--;
-            while (true) {
-                size_t next_idx = (idx + 1) & d->mask;
-                dict_entry_t* next = &d->entries[next_idx];
+bool dict_del(Runtime* runtime, void* dd, void* kk) {
+    Dict* d = (Dict*)dd;
+    if (!d) return false;  // Add NULL check
+    Object* key = (Object*)kk;
 
-                if (next->psl <= 1) {
-                    d->entries[idx].psl = 0;
-                    if (d->entries[idx].key) {
-                        DECREF(runtime, d->entries[idx].key);
-                    }
-                    if (d->entries[idx].value) {
-                        DECREF(runtime, d->entries[idx].value);
-                    }
-                    d->entries[idx].key = NULL;
-                    d->entries[idx].value = NULL;
-                    break;
-                }
+    int64_t h = hash(runtime, key);
+    size_t slot = (size_t)h & d->mask;
 
-                d->entries[idx] = *next;
-                d->entries[idx].psl--;
-                idx = next_idx;
+    while (true) {
+        int32_t ix = d->index[slot];
+        if (ix == DICT_IX_EMPTY) return false;
+        if (ix != DICT_IX_DELETED) {
+            dict_entry_t* curr = &d->entries[ix];
+            if (curr->hash == h && ObjectsEqual(runtime, curr->key, key)) {
+                // Tombstone both the index slot and the dense slot; the
+                // next growth compacts the log
+                DECREF(runtime, curr->key);
+                if (curr->value) DECREF(runtime, curr->value);
+                curr->key = NULL;
+                curr->value = NULL;
+                d->index[slot] = DICT_IX_DELETED;
+                d->count--;
+                d->version++;
+                ng_dict_live_entries--;
+                return true;
             }
-            return true;
         }
-
-        idx = (idx + 1) & d->mask;
-        psl++;
+        slot = (slot + 1) & d->mask;
     }
 }
 
@@ -2835,18 +3926,22 @@ void dict_destroy(Runtime* runtime, void* dd) {
     Dict* d = (Dict*)dd;
     if (!d) return;
 
-    for (size_t i = 0; i < d->capacity; i++) {
-        if (d->entries[i].psl > 0) {
-            DECREF(runtime, d->entries[i].key);
-            DECREF(runtime, d->entries[i].value);
-        }
+    ng_gc_untrack(runtime, (Object*)d);
+
+    ng_dict_live_count--;
+    ng_dict_live_entries -= d->count;
+    ng_dict_index_slots -= d->capacity;
+
+    for (size_t i = 0; i < d->used; i++) {
+        if (d->entries[i].key == NULL) continue;
+        DECREF(runtime, d->entries[i].key);
+        DECREF(runtime, d->entries[i].value);
     }
-    
-    // Free the entries array (allocated with alloc())
-    bool is_manual = d->__allocation__.is_manual == 1;
-    int pool_id = d->__allocation__.pool_id;
-    del(runtime, d->entries, is_manual, pool_id);
-    
+
+    // Free the entries and index arrays (allocated with alloc())
+    del(runtime, d->entries, d->__allocation__.is_manual == 1, d->__allocation__.pool_id);
+    del(runtime, d->index, d->__index_allocation__.is_manual == 1, d->__index_allocation__.pool_id);
+
     // Free the dict itself from the pool
     dynamic_pool_free(runtime->pool->dict, d);
 }
@@ -2888,22 +3983,18 @@ Object* alloc_instance(Runtime* runtime) {
     obj->base.__allocation__.is_manual = 0;
     obj->base.__flags__.type = OBJ_TYPE_INSTANCE;
 
+    ng_gc_track(runtime, (Object*)obj);
     return (Object*)obj;
 }
 
 Object* alloc_bool(Runtime* runtime, bool value) {
-    Bool* obj = (Bool*) dynamic_pool_alloc(runtime->pool->ints);
-    obj->base.__typename__ = get_symbol_id(runtime, "bool");
-    obj->base.__refcount__ = 1;
-    obj->base.__flags__.boolean = value ? 1 : 0;
-    ((IntObject*)obj)->__value__ = value ? 1 : 0;
-    obj->base.__allocation__.is_manual = 0;
-    obj->base.__flags__.type = OBJ_TYPE_INT;
-
-    return (Object*)obj;
+    return (Object*)&runtime->bool_cache[value ? 1 : 0];
 }
 
 Object* alloc_int(Runtime* runtime, int64_t value) {
+    if (value >= NG_SMALL_INT_MIN && value < NG_SMALL_INT_MAX) {
+        return (Object*)&runtime->small_ints[value - NG_SMALL_INT_MIN];
+    }
     IntObject* obj = (IntObject*) dynamic_pool_alloc(runtime->pool->ints);
     obj->base.__typename__ = get_symbol_id(runtime, "int");
     obj->base.__refcount__ = 1;
@@ -3006,11 +4097,70 @@ Object* alloc_str(Runtime* runtime, const char* data) {
     return (Object*)str_obj;
 }
 
+/* Interned strings: one immortal StringObject per distinct text.
+ * Builtin names and compile-time string constants go through here, so the
+ * method name handed to NgGetMember and the key stored in an instance
+ * dict are the same pointer and ObjectsEqual stops at pointer equality.
+ * Dynamically built strings are NOT interned: the table pins its entries
+ * for the life of the process, which only suits program-lifetime names.
+ */
+Object* alloc_str_interned(Runtime* runtime, const char* data) {
+    if (strlen(data) > 256) {
+        // Long texts are not identifier-like; don't pin them forever
+        return alloc_str(runtime, data);
+    }
+    int64_t key = (int64_t) siphash_cstr(data, runtime->siphash_key);
+    Object* existing = (Object*) hmap_get(runtime->interned_strings, key);
+    if (existing) {
+        return existing;
+    }
+    Object* str = alloc_str(runtime, data);
+    str->__refcount__ = NG_IMMORTAL_REFCOUNT;
+    hmap_put(runtime->interned_strings, key, str);
+    return str;
+}
+
+/* One pass over the static builtin name data: stamp the per-process
+ * fields (symbol id, hash), intern each entry, and fill the slots of
+ * runtime->builtin_names in declaration order. The struct is generated
+ * from the same NG_BUILTIN_NAMES list as the array, so the orders match
+ * by construction.
+ *
+ * Stamping happens once, from the main runtime, before any thread
+ * exists. Per-thread shards share the main runtime's siphash key, so
+ * the stamped symbol ids and hashes are valid for them too; their call
+ * only interns the entries and fills their slots.
+ */
+static bool ng_builtin_names_stamped = false;
+void ng_init_builtin_names(Runtime* runtime) {
+    bool stamp = !ng_builtin_names_stamped;
+    int32_t str_symbol = get_symbol_id(runtime, "str");
+    StringObject** slots = (StringObject**) &runtime->builtin_names;
+    for (size_t i = 0; i < NG_BUILTIN_NAME_COUNT; i++) {
+        NgStaticName* entry = &ng_builtin_name_data[i];
+        StringObject* s = &entry->s;
+        if (stamp) {
+            s->base.base.__typename__ = str_symbol;
+            s->base.base.__refcount__ = NG_IMMORTAL_REFCOUNT;
+            s->base.base.__flags__.type = OBJ_TYPE_STRING;
+            s->base.base.__flags__.boolean = 1;   // all names are ASCII
+            s->base.base.__flags__.reserved = 0;  // kind 0: one byte per char
+            s->base.base.__allocation__.is_manual = 1;
+            s->size = strlen(entry->data);
+            s->hash = (int64_t) siphash_cstr(entry->data, runtime->siphash_key);
+        }
+        hmap_put(runtime->interned_strings, s->hash, s);
+        slots[i] = s;
+    }
+    ng_builtin_names_stamped = true;
+}
+
 Object* alloc_bytes(Runtime* runtime, const char* data, size_t len) {
     BytesObject* bytes_obj = (BytesObject*) malloc(sizeof(BytesObject) + len);
 
     bytes_obj->base.base.__typename__ = get_symbol_id(runtime, "bytes");
     bytes_obj->base.base.__refcount__ = 1;
+    bytes_obj->base.__dict__ = NULL;
     bytes_obj->size = len;
     memcpy(bytes_obj->data, data, len);
     bytes_obj->base.base.__allocation__.is_manual = 1;
@@ -3035,7 +4185,15 @@ Object* alloc_function(Runtime* runtime, const char* name, int32_t line, size_t
 }
 
 Object* alloc_tuple(Runtime* runtime, size_t size, Object** objects) {
-    Tuple* tuple = (Tuple*) malloc(sizeof(Tuple) + (size - 1) * sizeof(Object*));
+    Tuple* tuple;
+    if (size >= 1 && size <= NG_TUPLE_FREELIST_ARITIES &&
+        runtime->tuple_freelist[size - 1]) {
+        tuple = runtime->tuple_freelist[size - 1];
+        runtime->tuple_freelist[size - 1] = (Tuple*) tuple->items[0];
+        runtime->tuple_freelist_depth[size - 1]--;
+    } else {
+        tuple = (Tuple*) malloc(sizeof(Tuple) + (size - 1) * sizeof(Object*));
+    }
 
     tuple->base.__typename__ = get_symbol_id(runtime, "tuple");
     tuple->base.__refcount__ = 1;
@@ -3168,6 +4326,7 @@ Object* alloc_list(Runtime* runtime) {
     list->__dict__ = NULL;
 
     list_init(runtime, list, 1);
+    ng_gc_track(runtime, (Object*)list);
     return add_list_functions(runtime, list);
 }
 
@@ -3183,6 +4342,7 @@ Object* alloc_list_empty(Runtime* runtime, size_t capacity) {
     for (size_t i = 0; i < capacity; i++) {
         list->items[i] = NULL;
     }
+    ng_gc_track(runtime, (Object*)list);
     return add_list_functions(runtime, list);
 }
 
@@ -3201,14 +4361,311 @@ Object* alloc_list_prefill(Runtime* runtime, size_t size, Object** items) {
         list->items[i] = items[i];
         INCREF(runtime, items[i]);
     }
+    ng_gc_track(runtime, (Object*)list);
     return add_list_functions(runtime, list);
 }
 
 
+Object* ng_buffer_wrap(Runtime* runtime, void* data, size_t nbytes, size_t elem_size) {
+    bool is_manual = false;
+    int pool_id = 0;
+    BufferObject* buf = (BufferObject*) alloc(runtime, sizeof(BufferObject), &is_manual, &pool_id, true);
+    if (!buf) {
+        fprintf(stderr, "Runtime Error: Failed to allocate buffer object\n");
+        exit(1);
+    }
+    buf->base.base.__flags__.type = OBJ_TYPE_BUFFER;
+    buf->base.base.__allocation__.is_manual = is_manual ? 1 : 0;
+    buf->base.base.__allocation__.pool_id = pool_id;
+    buf->base.base.__refcount__ = 1;
+    buf->base.base.__typename__ = get_symbol_id(runtime, "buffer");
+    buf->base.__dict__ = NULL;
+    buf->size = nbytes;
+    buf->elem_size = elem_size;
+    buf->data = data;
+    buf->owns_data = true;
+    return (Object*) buf;
+}
+
+/* Like ng_buffer_wrap, but the buffer borrows the memory instead of
+ * taking ownership: DECREF never frees it. Used for zero-copy views into
+ * file mappings. */
+Object* ng_buffer_view(Runtime* runtime, void* data, size_t nbytes, size_t elem_size) {
+    BufferObject* buf = (BufferObject*) ng_buffer_wrap(runtime, data, nbytes, elem_size);
+    buf->owns_data = false;
+    return (Object*) buf;
+}
+
+void* ng_buffer_data(Runtime* runtime, void* obj) {
+    Object* o = (Object*)obj;
+    if (!o || o->__flags__.type != OBJ_TYPE_BUFFER) {
+        fprintf(stderr, "TypeError: expected a nexc buffer, got '%s'\n",
+            o ? obj_type_name(runtime, o) : "None");
+        exit(1);
+    }
+    return ((BufferObject*)o)->data;
+}
+
+size_t ng_buffer_count(Runtime* runtime, void* obj) {
+    Object* o = (Object*)obj;
+    if (!o || o->__flags__.type != OBJ_TYPE_BUFFER) {
+        fprintf(stderr, "TypeError: expected a nexc buffer, got '%s'\n",
+            o ? obj_type_name(runtime, o) : "None");
+        exit(1);
+    }
+    BufferObject* buf = (BufferObject*)o;
+    return buf->elem_size ? buf->size / buf->elem_size : 0;
+}
+
+/* ---- File I/O ----
+ * open(path, mode="r") plus the read/readinto/write/close methods that get
+ * registered on the returned FileObject, mirroring add_list_functions.
+ */
+
+static FileObject* _ng_file_self(Runtime* runtime, Tuple* args, const char* method) {
+    if (!args || args->size < 1) {
+        fprintf(stderr, "TypeError: %s() missing required positional argument\n", method);
+        exit(1);
+    }
+    Object* self = args->items[0];
+    if (self->__flags__.type != OBJ_TYPE_FILE) {
+        fprintf(stderr, "TypeError: %s() expects a file object, got '%s'\n",
+            method, obj_type_name(runtime, self));
+        exit(1);
+    }
+    return (FileObject*) self;
+}
+
+Object* NgFileRead(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    FileObject* file = _ng_file_self(runtime, args, "read");
+    int64_t want = -1;
+    if (args->size >= 2) want = as_int(args->items[1]);
+
+    if (file->map_data) {
+        // Mapped mode: hand out a zero-copy view into the mapping and
+        // advance the cursor. The view borrows the mapping, so it is only
+        // valid until close().
+        size_t remaining = file->map_size - file->map_pos;
+        size_t n = (want < 0 || (size_t)want > remaining) ? remaining : (size_t)want;
+        Object* view = ng_buffer_view(runtime, file->map_data + file->map_pos, n, 1);
+        file->map_pos += n;
+        return view;
+    }
+
+    if (!file->fp) {
+        fprintf(stderr, "ValueError: I/O operation on closed file\n");
+        exit(1);
+    }
+
+    if (want >= 0) {
+        char* scratch = (char*) malloc(want > 0 ? (size_t)want : 1);
+        size_t got = fread(scratch, 1, (size_t)want, file->fp);
+        Object* bytes = alloc_bytes(runtime, scratch, got);
+        free(scratch);
+        return bytes;
+    }
+
+    // No size: read to EOF, doubling the scratch buffer as needed
+    size_t cap = 1 << 16;
+    size_t len = 0;
+    char* scratch = (char*) malloc(cap);
+    for (;;) {
+        len += fread(scratch + len, 1, cap - len, file->fp);
+        if (len < cap) break;
+        cap *= 2;
+        scratch = (char*) realloc(scratch, cap);
+    }
+    Object* bytes = alloc_bytes(runtime, scratch, len);
+    free(scratch);
+    return bytes;
+}
+
+Object* NgFileReadInto(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    FileObject* file = _ng_file_self(runtime, args, "readinto");
+    if (args->size < 2 || args->items[1]->__flags__.type != OBJ_TYPE_BUFFER) {
+        fprintf(stderr, "TypeError: readinto() expects a buffer argument\n");
+        exit(1);
+    }
+    BufferObject* buf = (BufferObject*) args->items[1];
+
+    size_t got;
+    if (file->map_data) {
+        size_t remaining = file->map_size - file->map_pos;
+        got = remaining < buf->size ? remaining : buf->size;
+        memcpy(buf->data, file->map_data + file->map_pos, got);
+        file->map_pos += got;
+    } else if (file->fp) {
+        got = fread(buf->data, 1, buf->size, file->fp);
+    } else {
+        fprintf(stderr, "ValueError: I/O operation on closed file\n");
+        exit(1);
+    }
+    return alloc_int(runtime, (int64_t) got);
+}
+
+Object* NgFileWrite(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    FileObject* file = _ng_file_self(runtime, args, "write");
+    if (args->size < 2) {
+        fprintf(stderr, "TypeError: write() missing required positional argument\n");
+        exit(1);
+    }
+    if (!file->fp) {
+        fprintf(stderr, "ValueError: file not open for writing\n");
+        exit(1);
+    }
+
+    Object* data = args->items[1];
+    size_t written = 0;
+    switch (data->__flags__.type) {
+        case OBJ_TYPE_STRING: {
+            const char* s = NgToCString(runtime, data);
+            written = fwrite(s, 1, strlen(s), file->fp);
+            break;
+        }
+        case OBJ_TYPE_BYTES: {
+            BytesObject* bytes = (BytesObject*) data;
+            written = fwrite(bytes->data, 1, bytes->size, file->fp);
+            break;
+        }
+        case OBJ_TYPE_BUFFER: {
+            BufferObject* buf = (BufferObject*) data;
+            written = fwrite(buf->data, 1, buf->size, file->fp);
+            break;
+        }
+        default:
+            fprintf(stderr, "TypeError: write() expects str, bytes or buffer, got '%s'\n",
+                obj_type_name(runtime, data));
+            exit(1);
+    }
+    return alloc_int(runtime, (int64_t) written);
+}
+
+Object* NgFileClose(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    FileObject* file = _ng_file_self(runtime, args, "close");
+    if (file->fp) {
+        fclose(file->fp);
+        file->fp = NULL;
+    }
+    if (file->map_data) {
+#if defined(__linux__)
+        if (file->map_is_mmap) {
+            munmap(file->map_data, file->map_size);
+        } else {
+            free(file->map_data);
+        }
+#else
+        free(file->map_data);
+#endif
+        file->map_data = NULL;
+        file->map_size = 0;
+        file->map_pos = 0;
+    }
+    return (Object*) runtime->builtin_names.none;
+}
+
+Object* NgFileOpen(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    if (!args || args->size < 1) {
+        fprintf(stderr, "TypeError: open() missing required positional argument: 'path'\n");
+        exit(1);
+    }
+    // NgToCString can return a shared scratch buffer: copy the path before
+    // converting the mode
+    char* path = strdup(NgToCString(runtime, args->items[0]));
+    const char* mode = "r";
+    if (args->size >= 2) mode = NgToCString(runtime, args->items[1]);
+
+    bool is_manual = false;
+    int pool_id = 0;
+    FileObject* file = (FileObject*) alloc(runtime, sizeof(FileObject), &is_manual, &pool_id, true);
+    if (!file) {
+        fprintf(stderr, "Runtime Error: Failed to allocate file object\n");
+        exit(1);
+    }
+    file->base.base.__flags__.type = OBJ_TYPE_FILE;
+    file->base.base.__allocation__.is_manual = is_manual ? 1 : 0;
+    file->base.base.__allocation__.pool_id = pool_id;
+    file->base.base.__refcount__ = 1;
+    file->base.base.__typename__ = get_symbol_id(runtime, "file");
+    file->base.__dict__ = NULL;
+
+    if (strchr(mode, 'm')) {
+#if defined(__linux__)
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            fprintf(stderr, "OSError: cannot open file '%s'\n", path);
+            exit(1);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            fprintf(stderr, "OSError: cannot stat file '%s'\n", path);
+            exit(1);
+        }
+        size_t len = (size_t) st.st_size;
+        if (len > 0) {
+            char* map = (char*) mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                fprintf(stderr, "OSError: cannot map file '%s'\n", path);
+                exit(1);
+            }
+            madvise(map, len, MADV_WILLNEED);
+            file->map_data = map;
+            file->map_is_mmap = true;
+        } else {
+            // Keep map_data non-NULL so an empty mapped file still reads
+            // as empty rather than closed
+            file->map_data = (char*) malloc(1);
+            file->map_is_mmap = false;
+        }
+        file->map_size = len;
+        close(fd);
+#else
+        // No mmap on this platform: slurp the file so mode "m" keeps its
+        // read-everything semantics, just without the zero-copy part
+        FILE* fp = fopen(path, "rb");
+        if (!fp) {
+            fprintf(stderr, "OSError: cannot open file '%s'\n", path);
+            exit(1);
+        }
+        fseek(fp, 0, SEEK_END);
+        long len = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        char* data = (char*) malloc(len > 0 ? (size_t)len : 1);
+        size_t got = fread(data, 1, len > 0 ? (size_t)len : 0, fp);
+        fclose(fp);
+        file->map_data = data;
+        file->map_size = got;
+        file->map_is_mmap = false;
+#endif
+    } else {
+        FILE* fp = fopen(path, mode);
+        if (!fp) {
+            fprintf(stderr, "OSError: cannot open file '%s'\n", path);
+            exit(1);
+        }
+        // Pipelines stream in strides far wider than the 4-8KB stdio
+        // default, so give every handle a 1MB buffer up front
+        setvbuf(fp, NULL, _IOFBF, 1 << 20);
+        file->fp = fp;
+    }
+    free(path);
+
+    NgSetMember(runtime, (Object*)file, runtime->builtin_names.read, (Object*)alloc_function(
+        runtime, "read", 0, 2, (void*)NgFileRead));
+    NgSetMember(runtime, (Object*)file, runtime->builtin_names.readinto, (Object*)alloc_function(
+        runtime, "readinto", 0, 2, (void*)NgFileReadInto));
+    NgSetMember(runtime, (Object*)file, runtime->builtin_names.write, (Object*)alloc_function(
+        runtime, "write", 0, 2, (void*)NgFileWrite));
+    NgSetMember(runtime, (Object*)file, runtime->builtin_names.close, (Object*)alloc_function(
+        runtime, "close", 0, 1, (void*)NgFileClose));
+    return (Object*) file;
+}
+
 void* INCREF(Runtime* runtime, void* obj) {
     if (obj != NULL) {
         Object* o = (Object*)obj;
+        if (o->__refcount__ >= NG_IMMORTAL_REFCOUNT) return obj;
         o->__refcount__++;
+        ng_incref_count++;
     }
     return obj;
 }
@@ -3217,7 +4674,9 @@ void* INCREF(Runtime* runtime, void* obj) {
 Object* DECREF(Runtime* runtime, void* obj) {
     if (obj != NULL) {
         Object* o = (Object*)obj;
+        if (o->__refcount__ >= NG_IMMORTAL_REFCOUNT) return (Object*)obj;
         o->__refcount__--;
+        ng_decref_count++;
         if (o->__refcount__ == 0) {
             int32_t obj_type = o->__flags__.type;
             bool is_manual = o->__allocation__.is_manual == 1;
@@ -3231,6 +4690,19 @@ Object* DECREF(Runtime* runtime, void* obj) {
                     break;
                 case OBJ_TYPE_INSTANCE: {
                     InstanceObject* inst = (InstanceObject*)o;
+                    ng_gc_untrack(runtime, o);
+                    NgSlotLayout* layout = ng_slot_layout(runtime, o->__typename__);
+                    if (layout) {
+                        // Slot-class instance: release slots, then the
+                        // oversized block it was carved from via alloc()
+                        Object** slots = NG_INSTANCE_SLOTS(inst);
+                        for (size_t i = 0; i < layout->count; i++) {
+                            if (slots[i]) DECREF(runtime, slots[i]);
+                        }
+                        DECREF(runtime, inst->__dict__);
+                        del(runtime, o, is_manual, o->__allocation__.pool_id);
+                        break;
+                    }
                     DECREF(runtime, inst->__dict__);
                     if (is_manual) {
                         del(runtime, o, is_manual, o->__allocation__.pool_id);
@@ -3263,6 +4735,50 @@ Object* DECREF(Runtime* runtime, void* obj) {
                     if (!is_manual) {
                         fprintf(stderr, "DECREF: Tuple should be manually allocated\n");
                     }
+                    if (tuple->size >= 1 && tuple->size <= NG_TUPLE_FREELIST_ARITIES &&
+                        runtime->tuple_freelist_depth[tuple->size - 1] < NG_TUPLE_FREELIST_MAX) {
+                        // Park it for reuse; items[0] is dead storage now
+                        // and doubles as the freelist link
+                        tuple->items[0] = (Object*) runtime->tuple_freelist[tuple->size - 1];
+                        runtime->tuple_freelist[tuple->size - 1] = tuple;
+                        runtime->tuple_freelist_depth[tuple->size - 1]++;
+                        break;
+                    }
+                    del(runtime, o, is_manual, o->__allocation__.pool_id);
+                    break;
+                }
+                case OBJ_TYPE_BUFFER: {
+                    BufferObject* buf = (BufferObject*)o;
+                    if (buf->data && buf->owns_data) {
+                        free(buf->data);
+                    }
+                    buf->data = NULL;
+                    if (buf->base.__dict__) {
+                        DECREF(runtime, buf->base.__dict__);
+                    }
+                    del(runtime, o, is_manual, o->__allocation__.pool_id);
+                    break;
+                }
+                case OBJ_TYPE_FILE: {
+                    // Dropping the last reference releases the OS
+                    // resources too; close() before this just means the
+                    // fields are already NULL
+                    FileObject* file = (FileObject*)o;
+                    if (file->fp) fclose(file->fp);
+                    if (file->map_data) {
+#if defined(__linux__)
+                        if (file->map_is_mmap) {
+                            munmap(file->map_data, file->map_size);
+                        } else {
+                            free(file->map_data);
+                        }
+#else
+                        free(file->map_data);
+#endif
+                    }
+                    if (file->base.__dict__) {
+                        DECREF(runtime, file->base.__dict__);
+                    }
                     del(runtime, o, is_manual, o->__allocation__.pool_id);
                     break;
                 }
@@ -3301,15 +4817,16 @@ Object* DECREF(Runtime* runtime, void* obj) {
                 }
                 case OBJ_TYPE_LIST: {
                     List* list = (List*)o;
-                    for (size_t i = 0; i < list->size; i++) {
-                        DECREF(runtime, list->items[i]);
-                    }
-                    free(list->items);
-                    if (is_manual) {
-                        del(runtime, o, is_manual, o->__allocation__.pool_id);
-                    } else {
-                        dynamic_pool_free(runtime->pool->list, o);
+                    ng_gc_untrack(runtime, o);
+                    if (list->store == LIST_STORE_OBJ) {
+                        for (size_t i = 0; i < list->size; i++) {
+                            DECREF(runtime, list->items[i]);
+                        }
                     }
+                    // The allocation bits describe the items array; the
+                    // header always comes from the typed list pool
+                    del(runtime, list->items, is_manual, o->__allocation__.pool_id);
+                    dynamic_pool_free(runtime->pool->list, o);
                     break;
                 }
                 case OBJ_TYPE_FUNCTION: {
@@ -3324,6 +4841,7 @@ Object* DECREF(Runtime* runtime, void* obj) {
                 }
                 case OBJ_TYPE_SET: {
                     Set* set = (Set*)o;
+                    ng_gc_untrack(runtime, o);
                     if (set->table) {
                         dict_destroy(runtime, set->table);
                     }
@@ -3365,24 +4883,13 @@ Object* DECREF(Runtime* runtime, void* obj) {
 
 Object* NgCatStr(Runtime* runtime, Object* a, Object* b)
 {
-    const char* a_str = NgToCString(runtime, a);
-    const char* b_str = NgToCString(runtime, b);
-
-    size_t a_len = strlen(a_str);
-    size_t b_len = strlen(b_str);
-
-    static _Thread_local char buffer[65536];
-    if (a_len + b_len >= sizeof(buffer)) {
-        fprintf(stderr, "Error: concatenated string too long\n");
-        exit(1);
-    }
-
-    memcpy(buffer, a_str, a_len);
-    memcpy(buffer + a_len, b_str, b_len);
-    buffer[a_len + b_len] = '\0';
-
-    Object* result = alloc_str(runtime, buffer);
-    return result;
+    NgStrBuilder sb;
+    ng_sb_init(&sb);
+    // One conversion at a time: NgToCString may hand back a shared
+    // thread-local scratch buffer
+    ng_sb_append_cstr(runtime, &sb, NgToCString(runtime, a));
+    ng_sb_append_cstr(runtime, &sb, NgToCString(runtime, b));
+    return ng_sb_finish(runtime, &sb);
 }
 
 Object* NgCatTuple(Runtime* runtime, void* aa, void* bb)
@@ -3458,23 +4965,12 @@ Object* NgPrependTuple(Runtime* runtime, void* ii, void* tt)
 
 Object* NgJoinedStr(Runtime* runtime, void** values, size_t count)
 {
-    static _Thread_local char buffer[131072];
-    size_t offset = 0;
+    NgStrBuilder sb;
+    ng_sb_init(&sb);
     for (size_t i = 0; i < count; i++) {
-        Object* val = (Object*)values[i];
-        const char* val_str = NgToCString(runtime, val);
-        size_t val_len = strlen(val_str);
-        if (offset + val_len >= sizeof(buffer)) {
-            fprintf(stderr, "Error: joined string too long\n");
-            exit(1);
-        }
-        memcpy(buffer + offset, val_str, val_len);
-        offset += val_len;
+        ng_sb_append_cstr(runtime, &sb, NgToCString(runtime, (Object*)values[i]));
     }
-
-    buffer[offset] = '\0';
-    Object* result = alloc_str(runtime, buffer);
-    return result;
+    return ng_sb_finish(runtime, &sb);
 }
 
 Object* NgFloatToFixed(Runtime* rt, Object* obj, int precision)
@@ -3710,6 +5206,7 @@ static Set* alloc_set_internal(Runtime* runtime, bool add_methods) {
     set->base.base.__flags__.type = OBJ_TYPE_SET;
     set->base.__dict__ = NULL;
     set->table = alloc_dict_internal(runtime, false);
+    ng_gc_track(runtime, (Object*)set);
     if (add_methods) add_set_functions(runtime, set);
     return set;
 }
@@ -3801,9 +5298,9 @@ Object* NgSetPop(Runtime* runtime, Tuple* args, Dict* kwargs) {
         fprintf(stderr, "KeyError: pop from an empty set\n");
         exit(1);
     }
-    for (size_t i = 0; i < table->capacity; i++) {
+    for (size_t i = 0; i < table->used; i++) {
         dict_entry_t* entry = &table->entries[i];
-        if (entry->psl == 0) continue;
+        if (entry->key == NULL) continue;
         Object* key = entry->key;
         Object* result = (Object*)INCREF(runtime, key);
         dict_del(runtime, table, key);
@@ -3821,9 +5318,9 @@ Object* NgSetUnion(Runtime* runtime, Tuple* args, Dict* kwargs) {
     Set* result = alloc_set_internal(runtime, true);
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             dict_set(runtime, result->table, entry->key, (Object*)runtime->builtin_names.none);
         }
     }
@@ -3843,9 +5340,9 @@ Object* NgSetIntersection(Runtime* runtime, Tuple* args, Dict* kwargs) {
     Set* result = alloc_set_internal(runtime, true);
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             Object* present = NgContains(runtime, other, entry->key);
             int64_t val = present ? NgCastToInt(runtime, present) : 0;
             if (present) DECREF(runtime, present);
@@ -3867,9 +5364,9 @@ Object* NgSetDifference(Runtime* runtime, Tuple* args, Dict* kwargs) {
     Set* result = alloc_set_internal(runtime, true);
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             Object* present = NgContains(runtime, other, entry->key);
             int64_t val = present ? NgCastToInt(runtime, present) : 0;
             if (present) DECREF(runtime, present);
@@ -3893,9 +5390,9 @@ Object* NgSetSymmetricDifference(Runtime* runtime, Tuple* args, Dict* kwargs) {
     _set_add_all(runtime, result, other);
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             Object* present = NgContains(runtime, other, entry->key);
             int64_t val = present ? NgCastToInt(runtime, present) : 0;
             if (present) DECREF(runtime, present);
@@ -3927,9 +5424,9 @@ Object* NgSetCopy(Runtime* runtime, Tuple* args, Dict* kwargs) {
     Set* result = alloc_set_internal(runtime, true);
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             dict_set(runtime, result->table, entry->key, (Object*)runtime->builtin_names.none);
         }
     }
@@ -3945,9 +5442,9 @@ Object* NgSetIsSubset(Runtime* runtime, Tuple* args, Dict* kwargs) {
     Object* other = args->items[1];
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             Object* present = NgContains(runtime, other, entry->key);
             int64_t val = present ? NgCastToInt(runtime, present) : 0;
             if (present) DECREF(runtime, present);
@@ -3990,9 +5487,9 @@ Object* NgSetIsDisjoint(Runtime* runtime, Tuple* args, Dict* kwargs) {
     Object* other = args->items[1];
     Dict* table = self->table;
     if (table) {
-        for (size_t i = 0; i < table->capacity; i++) {
+        for (size_t i = 0; i < table->used; i++) {
             dict_entry_t* entry = &table->entries[i];
-            if (entry->psl == 0) continue;
+            if (entry->key == NULL) continue;
             Object* present = NgContains(runtime, other, entry->key);
             int64_t val = present ? NgCastToInt(runtime, present) : 0;
             if (present) DECREF(runtime, present);
@@ -4003,3 +5500,241 @@ Object* NgSetIsDisjoint(Runtime* runtime, Tuple* args, Dict* kwargs) {
     }
     return alloc_bool(runtime, true);
 }
+
+/* * NATIVE THREADS
+ * spawn(f, args...) runs f on a POSIX thread against its own Runtime
+ * shard: private pools, symbol table, interned strings, trace and tuple
+ * freelists, so no allocation path anywhere needs a lock. A shard
+ * shares only the parent's immortal data: the siphash key (symbol ids
+ * are content hashes, so every shard derives the same id for the same
+ * name), the program constant table, the slot layouts registered at
+ * startup and the static builtin name objects.
+ *
+ * Values cross shard boundaries by copy, never by reference: spawn()
+ * arguments and the join() result may be int, float, bool or str (all
+ * duplicated into the receiving runtime) or an atomic counter from
+ * atomic_int() (an immortal malloc'd cell shared by pointer and updated
+ * with atomic instructions). Everything else is rejected - the
+ * share-nothing model is what makes the unsynchronized runtimes safe.
+ */
+
+typedef struct AtomicObject {
+    InstanceObject base;
+    int64_t        value;
+} AtomicObject;
+
+#if !defined(_WIN32)
+
+typedef struct ThreadObject {
+    InstanceObject base;
+    pthread_t      tid;
+    Runtime*       shard;
+    Object*        (*fn)(Runtime*, Tuple*, Dict*);
+    Tuple*         args;    /* already copied into the shard */
+    Object*        result;  /* shard-owned until join(), then a parent copy */
+    bool           joined;
+} ThreadObject;
+
+/* Fresh Runtime for one thread. Mirrors init_runtime except that the
+ * immortal, read-only pieces listed above come from the parent and no
+ * signal handlers or profiling timers are armed (those stay with the
+ * main runtime). */
+static Runtime* ng_runtime_shard_create(Runtime* parent) {
+    Runtime* rt = (Runtime*) malloc(sizeof(Runtime));
+    memset(rt, 0, sizeof(Runtime));
+    rt->const_count = parent->const_count;
+    rt->constants = parent->constants;       /* immortal program constants */
+    rt->slot_layouts = parent->slot_layouts; /* written only during startup */
+    memcpy(rt->siphash_key, parent->siphash_key, sizeof(rt->siphash_key));
+    rt->symbol_table = hmap_create();
+    rt->interned_strings = hmap_create();
+
+    rt->pool = (PoolCollection*) malloc(sizeof(PoolCollection));
+    rt->pool->base = dynamic_pool_create(sizeof(Object), 1024);
+    rt->pool->instance = dynamic_pool_create(sizeof(InstanceObject), 512);
+    rt->pool->ints = dynamic_pool_create(sizeof(IntObject), 2048);
+    rt->pool->floats = dynamic_pool_create(sizeof(FloatObject), 2048);
+    rt->pool->list = dynamic_pool_create(sizeof(List), 256);
+    rt->pool->dict = dynamic_pool_create(sizeof(Dict), 256);
+    rt->pool->set = dynamic_pool_create(sizeof(Set), 256);
+    rt->pool->functions = dynamic_pool_create(sizeof(Function), 512);
+    memset(rt->pool->powers_of_two, 0, sizeof(rt->pool->powers_of_two));
+
+    rt->gc_enabled = parent->gc_enabled;
+    rt->gc_threshold = parent->gc_threshold;
+    if (rt->gc_enabled) rt->gc_tracked = hmap_create();
+
+    ng_init_scalar_caches(rt);
+    ng_init_builtin_names(rt);
+    rt->classes = (Object*) alloc_dict(rt);
+    return rt;
+}
+
+static void ng_runtime_shard_destroy(Runtime* rt) {
+    for (int i = 0; i < NG_TUPLE_FREELIST_ARITIES; i++) {
+        Tuple* t = rt->tuple_freelist[i];
+        while (t) {
+            Tuple* next = (Tuple*) t->items[0];
+            free(t);
+            t = next;
+        }
+    }
+    dynamic_pool_destroy(rt->pool->base);
+    dynamic_pool_destroy(rt->pool->instance);
+    dynamic_pool_destroy(rt->pool->ints);
+    dynamic_pool_destroy(rt->pool->floats);
+    dynamic_pool_destroy(rt->pool->list);
+    dynamic_pool_destroy(rt->pool->dict);
+    dynamic_pool_destroy(rt->pool->set);
+    dynamic_pool_destroy(rt->pool->functions);
+    for (int i = 0; i < 64; i++) {
+        if (rt->pool->powers_of_two[i]) dynamic_pool_destroy(rt->pool->powers_of_two[i]);
+    }
+    free(rt->pool);
+    hmap_destroy(rt->symbol_table);
+    hmap_destroy(rt->interned_strings);
+    if (rt->gc_tracked) hmap_destroy(rt->gc_tracked);
+    /* constants and slot_layouts belong to the parent */
+    free(rt);
+}
+
+/* Copy one value into `dest`'s world. The returned object is allocated
+ * from dest's pools (or is one of dest's immortal cached scalars), so
+ * the sending shard can be torn down afterwards. */
+static Object* ng_thread_transfer(Runtime* dest, Object* obj) {
+    if (!obj) return NULL;
+    switch (obj->__flags__.type) {
+        case OBJ_TYPE_INT: {
+            int64_t value = ((IntObject*) obj)->__value__;
+            if (obj->__typename__ == get_symbol_id(dest, "bool")) {
+                return alloc_bool(dest, value != 0);
+            }
+            return alloc_int(dest, value);
+        }
+        case OBJ_TYPE_FLOAT:
+            return alloc_float(dest, ((FloatObject*) obj)->__value__);
+        case OBJ_TYPE_STRING:
+            return alloc_str(dest, NgToCString(dest, obj));
+        case OBJ_TYPE_ATOMIC:
+            return obj;  /* immortal shared cell: crossing is the point */
+        default:
+            fprintf(stderr,
+                "TypeError: cannot send '%s' across threads "
+                "(only int, float, bool, str and atomic values cross)\n",
+                obj_type_name(dest, obj));
+            exit(1);
+    }
+}
+
+static void* ng_thread_main(void* arg) {
+    ThreadObject* t = (ThreadObject*) arg;
+    t->result = t->fn(t->shard, t->args, NULL);
+    return NULL;
+}
+
+Object* NgSpawn(Runtime* runtime, Object* (*fn)(Runtime*, Tuple*, Dict*), Tuple* args) {
+    ThreadObject* t = (ThreadObject*) malloc(sizeof(ThreadObject));
+    memset(t, 0, sizeof(ThreadObject));
+    t->base.base.__typename__ = get_symbol_id(runtime, "thread");
+    t->base.base.__refcount__ = 1;
+    t->base.base.__flags__.type = OBJ_TYPE_THREAD;
+    t->base.base.__allocation__.is_manual = 1;
+    t->fn = fn;
+    t->shard = ng_runtime_shard_create(runtime);
+
+    // Arguments are copied into the shard here, on the spawning thread,
+    // while the shard is still quiescent
+    if (args && args->size > 0) {
+        Object** copies = (Object**) malloc(args->size * sizeof(Object*));
+        for (size_t i = 0; i < args->size; i++) {
+            copies[i] = ng_thread_transfer(t->shard, args->items[i]);
+        }
+        t->args = (Tuple*) alloc_tuple(t->shard, args->size, copies);
+        free(copies);
+    }
+
+    if (pthread_create(&t->tid, NULL, ng_thread_main, t) != 0) {
+        fprintf(stderr, "RuntimeError: spawn() could not create a thread\n");
+        exit(1);
+    }
+    return (Object*) t;
+}
+
+Object* NgJoin(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)kwargs;
+    if (!args || args->size < 1 || !args->items[0]
+            || args->items[0]->__flags__.type != OBJ_TYPE_THREAD) {
+        fprintf(stderr, "TypeError: join() expects a thread handle from spawn()\n");
+        exit(1);
+    }
+    ThreadObject* t = (ThreadObject*) args->items[0];
+    if (!t->joined) {
+        pthread_join(t->tid, NULL);
+        t->joined = true;
+        // Copy the result out before the shard (and every pool the
+        // result lives in) is torn down; join() is idempotent after
+        Object* copy = ng_thread_transfer(runtime, t->result);
+        ng_runtime_shard_destroy(t->shard);
+        t->shard = NULL;
+        t->result = copy;
+    }
+    return t->result;
+}
+
+#else  /* _WIN32 */
+
+Object* NgSpawn(Runtime* runtime, Object* (*fn)(Runtime*, Tuple*, Dict*), Tuple* args) {
+    (void)fn; (void)args; (void)runtime;
+    fprintf(stderr, "RuntimeError: spawn() is not supported on Windows\n");
+    exit(1);
+}
+
+Object* NgJoin(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)runtime; (void)args; (void)kwargs;
+    fprintf(stderr, "RuntimeError: join() is not supported on Windows\n");
+    exit(1);
+}
+
+#endif  /* _WIN32 */
+
+/* atomic_int(initial): a shareable 64-bit counter. The cell is immortal
+ * and malloc'd outside every pool, so any shard may hold it and
+ * INCREF/DECREF never touch it. */
+Object* NgAtomicInt(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)kwargs;
+    AtomicObject* a = (AtomicObject*) malloc(sizeof(AtomicObject));
+    memset(a, 0, sizeof(AtomicObject));
+    a->base.base.__typename__ = get_symbol_id(runtime, "atomic");
+    a->base.base.__refcount__ = NG_IMMORTAL_REFCOUNT;
+    a->base.base.__flags__.type = OBJ_TYPE_ATOMIC;
+    a->base.base.__allocation__.is_manual = 1;
+    if (args && args->size > 0) {
+        a->value = NgCastToInt(runtime, args->items[0]);
+    }
+    return (Object*) a;
+}
+
+static AtomicObject* _ng_atomic_self(Runtime* runtime, Tuple* args, const char* fn) {
+    if (!args || args->size < 1 || !args->items[0]
+            || args->items[0]->__flags__.type != OBJ_TYPE_ATOMIC) {
+        fprintf(stderr, "TypeError: %s() expects an atomic_int() value\n", fn);
+        exit(1);
+    }
+    return (AtomicObject*) args->items[0];
+}
+
+/* atomic_add(a, n): add n and return the new value, as one atomic
+ * read-modify-write (sequentially consistent). */
+Object* NgAtomicAdd(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)kwargs;
+    AtomicObject* a = _ng_atomic_self(runtime, args, "atomic_add");
+    int64_t delta = args->size > 1 ? NgCastToInt(runtime, args->items[1]) : 1;
+    int64_t value = __atomic_add_fetch(&a->value, delta, __ATOMIC_SEQ_CST);
+    return alloc_int(runtime, value);
+}
+
+Object* NgAtomicGet(Runtime* runtime, Tuple* args, Dict* kwargs) {
+    (void)kwargs;
+    AtomicObject* a = _ng_atomic_self(runtime, args, "atomic_get");
+    return alloc_int(runtime, __atomic_load_n(&a->value, __ATOMIC_SEQ_CST));
+}
@@ -1,32 +1,64 @@
-/* * CONFIGURATION 
- * INITIAL_CAPACITY: Must be a power of 2.
- * LOAD_FACTOR_PERCENT: Threshold to resize (85-90% is safe for Robin Hood).
+/* * CONFIGURATION
+ * HMAP_INITIAL_CAPACITY: Must be a power of 2 and a multiple of HMAP_GROUP.
+ * HMAP_LOAD_FACTOR_PERCENT: Threshold to resize (85-90% is safe here).
  */
-#define HMAP_INITIAL_CAPACITY 2
+#define HMAP_INITIAL_CAPACITY 16
 #define HMAP_LOAD_FACTOR_PERCENT 85
 
+/* * LAYOUT
+ * Swiss-table style open addressing: a separate 1-byte control array runs
+ * parallel to the entry array. Each control byte is either EMPTY, DELETED
+ * (tombstone) or the low 7 bits of the hash (H2). Lookups scan the control
+ * array one 16-slot group at a time - with SSE2 where available, scalar
+ * otherwise - and only touch the 16-byte entries on a control-byte match,
+ * so a collision costs a byte compare instead of a cache miss per probe.
+ */
+#define HMAP_GROUP 16
+#define HMAP_CTRL_EMPTY   0x80
+#define HMAP_CTRL_DELETED 0xFE
+
+/* * INCREMENTAL RESIZE
+ * Rehashing a huge table in one shot stalls the caller for the whole
+ * migration. Above HMAP_INCREMENTAL_MIN slots, a resize instead keeps the
+ * old arrays alive and every put/get/remove migrates a bounded batch of
+ * old slots into the new table; the old arrays are freed once the sweep
+ * completes. Migrated old slots become DELETED so probe chains through
+ * the old table stay intact for keys that have not moved yet.
+ */
+#define HMAP_INCREMENTAL_MIN 4096
+#define HMAP_MIGRATE_STEP 64
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 typedef struct {
     int64_t key;
     void* value;
-    /* * PSL (Probe Sequence Length): 
-     * 0 = Empty slot
-     * 1 = Item is at its ideal hash index
-     * >1 = Item was shifted due to collision
-     */
-    uint32_t psl; 
 } hmap_entry_t;
 
 typedef struct {
+    uint8_t* ctrl;       // One control byte per slot
     hmap_entry_t* entries;
-    size_t capacity;     // Total slots available
-    size_t count;        // Active items
+    size_t capacity;     // Total slots available (multiple of HMAP_GROUP)
+    size_t count;        // Active items (including not-yet-migrated ones)
+    size_t tombstones;   // DELETED slots (reclaimed on resize)
     size_t mask;         // capacity - 1 (for fast modulo)
-    size_t threshold;    // Count at which we resize
+    size_t threshold;    // count + tombstones at which we resize
+
+    /* In-flight incremental resize; old_ctrl is NULL when none is active */
+    uint8_t* old_ctrl;
+    hmap_entry_t* old_entries;
+    size_t old_capacity;
+    size_t old_mask;
+    size_t migrate_pos;  // Next old-table index to sweep
 } hmap_t;
 
-/* --- Hashing Helper --- 
+/* --- Hashing Helper ---
  * SplitMix64-style mixer. Invertible and high entropy.
  * Crucial for int64 keys to prevent patterns in pointers/ints from causing collisions.
+ * The mixed hash is split: the top bits (H1) pick the starting group, the
+ * low 7 bits (H2) go into the control byte.
  */
 static inline uint64_t _hmap_hash(int64_t k) {
     uint64_t x = (uint64_t)k;
@@ -36,6 +68,37 @@ static inline uint64_t _hmap_hash(int64_t k) {
     return x;
 }
 
+static inline uint8_t _hmap_h2(uint64_t h) {
+    return (uint8_t)(h & 0x7F);
+}
+
+/* --- Group scanning ---
+ * Returns a bitmask of the slots in the 16-byte group at `ctrl` whose
+ * control byte equals `byte`, and a bitmask of EMPTY slots. Groups are
+ * aligned to HMAP_GROUP so a scan never crosses the end of the array.
+ */
+static inline uint32_t _hmap_group_match(const uint8_t* ctrl, uint8_t byte) {
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    __m128i match = _mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte));
+    return (uint32_t)_mm_movemask_epi8(match);
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < HMAP_GROUP; i++) {
+        if (ctrl[i] == byte) mask |= (1u << i);
+    }
+    return mask;
+#endif
+}
+
+static inline uint32_t _hmap_group_empty(const uint8_t* ctrl) {
+    return _hmap_group_match(ctrl, HMAP_CTRL_EMPTY);
+}
+
+static inline int _hmap_ctz(uint32_t mask) {
+    return __builtin_ctz(mask);
+}
+
 /* --- API Implementation --- */
 
 /* Initialize the map. Returns NULL on allocation failure. */
@@ -45,194 +108,322 @@ hmap_t* hmap_create(void) {
 
     map->capacity = HMAP_INITIAL_CAPACITY;
     map->count = 0;
+    map->tombstones = 0;
     map->mask = map->capacity - 1;
     map->threshold = (map->capacity * HMAP_LOAD_FACTOR_PERCENT) / 100;
-    
-    // Calloc ensures all PSLs are 0 (EMPTY)
+
+    map->ctrl = (uint8_t*)malloc(map->capacity);
     map->entries = (hmap_entry_t*)calloc(map->capacity, sizeof(hmap_entry_t));
-    
-    if (!map->entries) {
+
+    if (!map->ctrl || !map->entries) {
+        free(map->ctrl);
+        free(map->entries);
         free(map);
         return NULL;
     }
-    
+    memset(map->ctrl, HMAP_CTRL_EMPTY, map->capacity);
+
+    map->old_ctrl = NULL;
+    map->old_entries = NULL;
+    map->old_capacity = 0;
+    map->old_mask = 0;
+    map->migrate_pos = 0;
+
     return map;
 }
 
 void hmap_destroy(hmap_t* map) {
     if (map) {
+        free(map->old_ctrl);
+        free(map->old_entries);
+        free(map->ctrl);
         free(map->entries);
         free(map);
     }
 }
 
-/* Internal function to resize and rehash */
+/* Internal: insert without duplicate checking (keys known unique).
+ * Does not touch count; callers account for it. */
+static void _hmap_insert_unique(hmap_t* map, int64_t key, void* value) {
+    uint64_t h = _hmap_hash(key);
+    uint8_t h2 = _hmap_h2(h);
+    size_t group = ((h >> 7) & map->mask) & ~(size_t)(HMAP_GROUP - 1);
+
+    while (true) {
+        uint32_t avail = _hmap_group_match(map->ctrl + group, HMAP_CTRL_EMPTY)
+                       | _hmap_group_match(map->ctrl + group, HMAP_CTRL_DELETED);
+        if (avail) {
+            size_t idx = group + (size_t)_hmap_ctz(avail);
+            map->ctrl[idx] = h2;
+            map->entries[idx].key = key;
+            map->entries[idx].value = value;
+            return;
+        }
+        group = (group + HMAP_GROUP) & map->mask;
+    }
+}
+
+/* Internal: sweep up to `budget` old-table slots into the new table.
+ * Frees the old arrays once the sweep reaches the end. */
+static void _hmap_migrate_step(hmap_t* map, size_t budget) {
+    if (!map->old_ctrl) return;
+
+    size_t end = map->migrate_pos + budget;
+    if (end > map->old_capacity) end = map->old_capacity;
+
+    for (size_t i = map->migrate_pos; i < end; ++i) {
+        if (!(map->old_ctrl[i] & 0x80)) {
+            _hmap_insert_unique(map, map->old_entries[i].key, map->old_entries[i].value);
+            // DELETED (not EMPTY) so old probe chains stay walkable
+            map->old_ctrl[i] = HMAP_CTRL_DELETED;
+        }
+    }
+    map->migrate_pos = end;
+
+    if (map->migrate_pos >= map->old_capacity) {
+        free(map->old_ctrl);
+        free(map->old_entries);
+        map->old_ctrl = NULL;
+        map->old_entries = NULL;
+        map->old_capacity = 0;
+        map->old_mask = 0;
+        map->migrate_pos = 0;
+    }
+}
+
+static void _hmap_migrate_finish(hmap_t* map) {
+    while (map->old_ctrl) {
+        _hmap_migrate_step(map, map->old_capacity);
+    }
+}
+
+/* Internal: locate a not-yet-migrated key in the old table.
+ * Returns its index, or (size_t)-1 if absent. */
+static size_t _hmap_find_old(hmap_t* map, int64_t key, uint64_t h, uint8_t h2) {
+    size_t group = ((h >> 7) & map->old_mask) & ~(size_t)(HMAP_GROUP - 1);
+
+    while (true) {
+        const uint8_t* gctrl = map->old_ctrl + group;
+
+        uint32_t match = _hmap_group_match(gctrl, h2);
+        while (match) {
+            size_t idx = group + (size_t)_hmap_ctz(match);
+            if (map->old_entries[idx].key == key) {
+                return idx;
+            }
+            match &= match - 1;
+        }
+
+        if (_hmap_group_empty(gctrl)) {
+            return (size_t)-1;
+        }
+
+        group = (group + HMAP_GROUP) & map->old_mask;
+    }
+}
+
+/* Internal function to resize and rehash (also reclaims tombstones).
+ * Small tables rehash in one shot; large ones migrate incrementally. */
 static bool _hmap_resize(hmap_t* map, size_t new_capacity) {
+    // Only one migration can be in flight at a time
+    _hmap_migrate_finish(map);
+
+    uint8_t* old_ctrl = map->ctrl;
     hmap_entry_t* old_entries = map->entries;
     size_t old_capacity = map->capacity;
+    size_t old_mask = map->mask;
 
+    uint8_t* new_ctrl = (uint8_t*)malloc(new_capacity);
     hmap_entry_t* new_entries = (hmap_entry_t*)calloc(new_capacity, sizeof(hmap_entry_t));
-    if (!new_entries) return false;
+    if (!new_ctrl || !new_entries) {
+        free(new_ctrl);
+        free(new_entries);
+        return false;
+    }
+    memset(new_ctrl, HMAP_CTRL_EMPTY, new_capacity);
 
+    map->ctrl = new_ctrl;
     map->entries = new_entries;
     map->capacity = new_capacity;
     map->mask = new_capacity - 1;
     map->threshold = (new_capacity * HMAP_LOAD_FACTOR_PERCENT) / 100;
-    map->count = 0; // We will re-increment this via put
-
-    // Rehash all existing items
-    for (size_t i = 0; i < old_capacity; ++i) {
-        if (old_entries[i].psl > 0) {
-            // We use a simplified put logic here as we know keys are unique
-            hmap_entry_t entry = old_entries[i];
-            entry.psl = 1; // Reset PSL for new sizing
-            
-            size_t idx = _hmap_hash(entry.key) & map->mask;
-            
-            while (true) {
-                if (map->entries[idx].psl == 0) {
-                    map->entries[idx] = entry;
-                    map->count++;
-                    break;
-                }
-                
-                // Robin Hood Swap
-                if (entry.psl > map->entries[idx].psl) {
-                    hmap_entry_t temp = map->entries[idx];
-                    map->entries[idx] = entry;
-                    entry = temp;
-                }
-                
-                idx = (idx + 1) & map->mask;
-                entry.psl++;
+    map->tombstones = 0;
+
+    if (old_capacity < HMAP_INCREMENTAL_MIN) {
+        // Small table: migrate in one shot
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!(old_ctrl[i] & 0x80)) {
+                _hmap_insert_unique(map, old_entries[i].key, old_entries[i].value);
             }
         }
+        free(old_ctrl);
+        free(old_entries);
+        return true;
     }
 
-    free(old_entries);
+    map->old_ctrl = old_ctrl;
+    map->old_entries = old_entries;
+    map->old_capacity = old_capacity;
+    map->old_mask = old_mask;
+    map->migrate_pos = 0;
+    _hmap_migrate_step(map, HMAP_MIGRATE_STEP);
     return true;
 }
 
 /* * Insert or Update.
- * Returns 0 on success, -1 on allocation failure. 
+ * Returns 0 on success, -1 on allocation failure.
  */
 int hmap_put(hmap_t* map, int64_t key, void* value) {
-    if (map->count >= map->threshold) {
+    _hmap_migrate_step(map, HMAP_MIGRATE_STEP);
+
+    if (map->count + map->tombstones >= map->threshold) {
         if (!_hmap_resize(map, map->capacity * 2)) {
             return -1;
         }
     }
 
-    size_t idx = _hmap_hash(key) & map->mask;
-    uint32_t current_psl = 1;
-    
-    hmap_entry_t entry_to_insert = { .key = key, .value = value, .psl = current_psl };
+    uint64_t h = _hmap_hash(key);
+    uint8_t h2 = _hmap_h2(h);
+
+    // A not-yet-migrated key must be updated in place, not inserted twice
+    if (map->old_ctrl) {
+        size_t old_idx = _hmap_find_old(map, key, h, h2);
+        if (old_idx != (size_t)-1) {
+            map->old_entries[old_idx].value = value;
+            return 0;
+        }
+    }
+
+    size_t group = ((h >> 7) & map->mask) & ~(size_t)(HMAP_GROUP - 1);
+    size_t insert_idx = (size_t)-1;
 
     while (true) {
-        hmap_entry_t* curr = &map->entries[idx];
+        const uint8_t* gctrl = map->ctrl + group;
 
-        // 1. Found empty slot: Insert
-        if (curr->psl == 0) {
-            *curr = entry_to_insert;
-            map->count++;
-            return 0;
+        // 1. Check candidate slots for an existing key (update in place)
+        uint32_t match = _hmap_group_match(gctrl, h2);
+        while (match) {
+            size_t idx = group + (size_t)_hmap_ctz(match);
+            if (map->entries[idx].key == key) {
+                map->entries[idx].value = value;
+                return 0;
+            }
+            match &= match - 1;
         }
 
-        // 2. Found existing key: Update value
-        if (curr->key == key) {
-            curr->value = value;
-            return 0;
+        // 2. Remember the first reusable slot seen along the probe path
+        if (insert_idx == (size_t)-1) {
+            uint32_t avail = _hmap_group_match(gctrl, HMAP_CTRL_EMPTY)
+                           | _hmap_group_match(gctrl, HMAP_CTRL_DELETED);
+            if (avail) {
+                insert_idx = group + (size_t)_hmap_ctz(avail);
+            }
         }
 
-        // 3. Robin Hood: Steal the slot if our probe length is richer (larger)
-        if (entry_to_insert.psl > curr->psl) {
-            hmap_entry_t temp = *curr;
-            *curr = entry_to_insert;
-            entry_to_insert = temp;
+        // 3. An EMPTY slot ends the probe: the key is not in the map
+        if (_hmap_group_empty(gctrl)) {
+            if (map->ctrl[insert_idx] == HMAP_CTRL_DELETED) {
+                map->tombstones--;
+            }
+            map->ctrl[insert_idx] = h2;
+            map->entries[insert_idx].key = key;
+            map->entries[insert_idx].value = value;
+            map->count++;
+            return 0;
         }
 
-        // Continue probing
-        idx = (idx + 1) & map->mask;
-        entry_to_insert.psl++;
+        group = (group + HMAP_GROUP) & map->mask;
     }
 }
 
 /* * Lookup.
- * Returns value if found, NULL if not found. 
+ * Returns value if found, NULL if not found.
  * Note: If you store NULL values, you need a different signature (bool return).
  */
 void* hmap_get(hmap_t* map, int64_t key) {
-    size_t idx = _hmap_hash(key) & map->mask;
-    uint32_t current_psl = 1;
+    _hmap_migrate_step(map, HMAP_MIGRATE_STEP);
+
+    uint64_t h = _hmap_hash(key);
+    uint8_t h2 = _hmap_h2(h);
+    size_t group = ((h >> 7) & map->mask) & ~(size_t)(HMAP_GROUP - 1);
 
     while (true) {
-        hmap_entry_t* curr = &map->entries[idx];
+        const uint8_t* gctrl = map->ctrl + group;
 
-        // Slot is empty -> Key definitely not in map
-        if (curr->psl == 0) {
-            return NULL;
+        // Probe every slot in the group whose control byte matches H2
+        uint32_t match = _hmap_group_match(gctrl, h2);
+        while (match) {
+            size_t idx = group + (size_t)_hmap_ctz(match);
+            if (map->entries[idx].key == key) {
+                return map->entries[idx].value;
+            }
+            match &= match - 1;
         }
 
-        // Key matches
-        if (curr->key == key) {
-            return curr->value;
+        // An EMPTY slot in the group means the key is not in the new table
+        if (_hmap_group_empty(gctrl)) {
+            break;
         }
 
-        /* * Optimization (Early Exit):
-         * If the current element has a smaller PSL than our current probe distance,
-         * it means our key *would* have been here if it existed (because of the swap logic).
-         * Since it's not here, it's nowhere.
-         */
-        if (curr->psl < current_psl) {
-            return NULL;
-        }
+        group = (group + HMAP_GROUP) & map->mask;
+    }
 
-        idx = (idx + 1) & map->mask;
-        current_psl++;
+    // During an incremental resize the key may still be in the old table
+    if (map->old_ctrl) {
+        size_t old_idx = _hmap_find_old(map, key, h, h2);
+        if (old_idx != (size_t)-1) {
+            return map->old_entries[old_idx].value;
+        }
     }
+    return NULL;
 }
 
 /*
  * Remove a key.
- * Uses backward-shifting to maintain Robin Hood invariant without tombstones.
+ * Leaves a DELETED control byte (tombstone) so later probes keep walking;
+ * tombstones are reclaimed wholesale on the next resize.
  * Returns true if removed, false if not found.
  */
 bool hmap_remove(hmap_t* map, int64_t key) {
-    size_t idx = _hmap_hash(key) & map->mask;
-    uint32_t current_psl = 1;
+    _hmap_migrate_step(map, HMAP_MIGRATE_STEP);
+
+    uint64_t h = _hmap_hash(key);
+    uint8_t h2 = _hmap_h2(h);
+    size_t group = ((h >> 7) & map->mask) & ~(size_t)(HMAP_GROUP - 1);
 
     while (true) {
-        hmap_entry_t* curr = &map->entries[idx];
+        const uint8_t* gctrl = map->ctrl + group;
+
+        uint32_t match = _hmap_group_match(gctrl, h2);
+        while (match) {
+            size_t idx = group + (size_t)_hmap_ctz(match);
+            if (map->entries[idx].key == key) {
+                map->ctrl[idx] = HMAP_CTRL_DELETED;
+                map->entries[idx].key = 0;
+                map->entries[idx].value = NULL;
+                map->count--;
+                map->tombstones++;
+                return true;
+            }
+            match &= match - 1;
+        }
 
-        if (curr->psl == 0 || current_psl > curr->psl) {
-            return false; // Not found
+        if (_hmap_group_empty(gctrl)) {
+            break;
         }
 
-        if (curr->key == key) {
-            // Found it. Now backward shift to close the gap.
+        group = (group + HMAP_GROUP) & map->mask;
+    }
+
+    if (map->old_ctrl) {
+        size_t old_idx = _hmap_find_old(map, key, h, h2);
+        if (old_idx != (size_t)-1) {
+            map->old_ctrl[old_idx] = HMAP_CTRL_DELETED;
+            map->old_entries[old_idx].key = 0;
+            map->old_entries[old_idx].value = NULL;
             map->count--;
-            
-            while (true) {
-                size_t next_idx = (idx + 1) & map->mask;
-                hmap_entry_t* next = &map->entries[next_idx];
-                
-                // Stop if next slot is empty or next item is at its ideal position (PSL 1)
-                if (next->psl <= 1) {
-                    map->entries[idx].psl = 0; // Mark current as empty
-                    map->entries[idx].value = NULL;
-                    map->entries[idx].key = 0;
-                    break;
-                }
-                
-                // Shift next item back into current slot
-                map->entries[idx] = *next;
-                map->entries[idx].psl--; // It's now closer to its home
-                idx = next_idx;
-            }
             return true;
         }
-
-        idx = (idx + 1) & map->mask;
-        current_psl++;
     }
-}
\ No newline at end of file
+    return false;
+}
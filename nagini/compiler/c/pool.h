@@ -104,15 +104,60 @@ typedef struct {
     pool_page_t* page;
 } block_header_t;
 
+/* * Per-Thread Magazines
+ * A magazine is a small thread-local stack of ready-to-use blocks layered
+ * over the shared page lists. The common alloc/free path only touches the
+ * calling thread's magazine, so it stays O(1) and contention-free; the
+ * shared lists are only visited to refill or flush a magazine in batches,
+ * under a spinlock. Each thread claims a magazine slot on first use;
+ * threads beyond POOL_MAX_THREADS skip the magazines and go straight to
+ * the locked slow path, which is correct but serialized.
+ */
+#define POOL_MAX_THREADS 64
+#define POOL_MAGAZINE_SIZE 32
+
+typedef struct {
+    void* blocks[POOL_MAGAZINE_SIZE];
+    size_t count;
+} pool_magazine_t;
+
 typedef struct {
     size_t block_payload_size; // Size the user requested
     size_t block_total_size;   // Size + Header + Alignment padding
     size_t blocks_per_page;
-    
+
     pool_page_t* partial_pages; // Pages with available slots
     pool_page_t* full_pages;    // Pages that are completely full
+
+    size_t page_count;          // Pages currently held (partial + full)
+    size_t page_high_water;     // Most pages ever held at once
+
+    volatile char lock;         // Spinlock protecting the page lists
+    pool_magazine_t* magazines[POOL_MAX_THREADS];
 } dynamic_pool_t;
 
+/* Thread slot assignment: each thread gets a stable index into the
+ * per-pool magazine arrays the first time it allocates. */
+static _Thread_local int _pool_thread_slot_tls = -1;
+static int _pool_thread_counter = 0;
+
+static inline int _pool_thread_slot(void) {
+    if (_pool_thread_slot_tls < 0) {
+        _pool_thread_slot_tls = __atomic_fetch_add(&_pool_thread_counter, 1, __ATOMIC_RELAXED);
+    }
+    return _pool_thread_slot_tls;
+}
+
+static inline void _pool_lock(dynamic_pool_t* pool) {
+    while (__atomic_test_and_set(&pool->lock, __ATOMIC_ACQUIRE)) {
+        /* spin: critical sections are a handful of pointer updates */
+    }
+}
+
+static inline void _pool_unlock(dynamic_pool_t* pool) {
+    __atomic_clear(&pool->lock, __ATOMIC_RELEASE);
+}
+
 
 /* --- Helper: List Management --- */
 
@@ -149,6 +194,10 @@ dynamic_pool_t* dynamic_pool_create(size_t block_size, size_t blocks_per_page) {
     pool->blocks_per_page = blocks_per_page;
     pool->partial_pages = NULL;
     pool->full_pages = NULL;
+    pool->page_count = 0;
+    pool->page_high_water = 0;
+    pool->lock = 0;
+    memset(pool->magazines, 0, sizeof(pool->magazines));
 
     return pool;
 }
@@ -188,24 +237,29 @@ static int _expand_pool(dynamic_pool_t* pool) {
 
     // New pages always start in the partial list
     _push_page(&pool->partial_pages, page);
+    pool->page_count++;
+    if (pool->page_count > pool->page_high_water) {
+        pool->page_high_water = pool->page_count;
+    }
     return 0;
 }
 
-void* dynamic_pool_alloc(dynamic_pool_t* pool) {
+/* Internal: pop one block from the shared page lists. Caller holds the lock. */
+static void* _pool_alloc_block_locked(dynamic_pool_t* pool) {
     // If no pages have space, create a new one
     if (!pool->partial_pages) {
         if (_expand_pool(pool) != 0) return NULL;
     }
 
     pool_page_t* page = pool->partial_pages;
-    
+
     // 1. Pop block from page's free list
     uint8_t* raw_block = (uint8_t*)page->free_head;
-    
+
     // The "Next Free" pointer is stored just after the header
     void** next_ptr_loc = (void**)(raw_block + sizeof(block_header_t));
     page->free_head = *next_ptr_loc;
-    
+
     page->used_count++;
 
     // 2. If page is now full, move from Partial -> Full list
@@ -215,24 +269,17 @@ void* dynamic_pool_alloc(dynamic_pool_t* pool) {
         _push_page(&pool->full_pages, page);
     }
 
-    // 3. Zero the payload to prevent use of stale data from previous allocations
-    // The actual payload size is block_total_size - header size
-    void* payload = (void*)(raw_block + sizeof(block_header_t));
-    size_t payload_size = pool->block_total_size - sizeof(block_header_t);
-    memset(payload, 0, payload_size);
-    
-    // 4. Return pointer to the payload (hiding the header)
-    return payload;
+    // 3. Return pointer to the payload (hiding the header)
+    return (void*)(raw_block + sizeof(block_header_t));
 }
 
-void dynamic_pool_free(dynamic_pool_t* pool, void* ptr) {
-    if (!ptr) return;
-
+/* Internal: return one block to the shared page lists. Caller holds the lock. */
+static void _pool_free_block_locked(dynamic_pool_t* pool, void* ptr) {
     // 1. Recover the Hidden Header to find the Page
     uint8_t* payload = (uint8_t*)ptr;
     uint8_t* raw_block = payload - sizeof(block_header_t);
     block_header_t* header = (block_header_t*)raw_block;
-    
+
     pool_page_t* page = header->page;
 
     // 2. If page was Full, it is now Partial (because we are freeing a slot)
@@ -248,22 +295,185 @@ void dynamic_pool_free(dynamic_pool_t* pool, void* ptr) {
 
     page->used_count--;
 
-    // NOTE: We intentionally do NOT free empty pages back to the OS.
+    // NOTE: We intentionally do NOT free empty pages back to the OS here.
     // Keeping pages allocated has several benefits:
     // 1. Avoids potential use-after-free bugs if there are lingering references
     // 2. Improves performance by keeping memory warm for reuse
     // 3. Reduces malloc/free overhead
-    // The pages will be properly freed when the entire pool is destroyed.
-    
+    // The pages will be properly freed when the entire pool is destroyed,
+    // and long-running programs can release empty pages explicitly with
+    // dynamic_pool_trim() (NgTrimMemory() at the language level).
+
     // if (page->used_count == 0) {
     //     _unlink_page(&pool->partial_pages, page);
     //     free(page);
     // }
 }
 
+/* Allocation counter for the profiler's exit report. A plain increment on
+ * every alloc is in the noise next to the magazine pop it accompanies;
+ * thread-local so spawn() shards don't contend (the report covers the
+ * main thread, which is where profiling is armed). */
+_Thread_local uint64_t ng_pool_alloc_count = 0;
+
+void* dynamic_pool_alloc(dynamic_pool_t* pool) {
+    ng_pool_alloc_count++;
+    size_t payload_size = pool->block_total_size - sizeof(block_header_t);
+    int slot = _pool_thread_slot();
+
+    if (slot >= POOL_MAX_THREADS) {
+        // Out of magazine slots: correct but serialized slow path
+        _pool_lock(pool);
+        void* payload = _pool_alloc_block_locked(pool);
+        _pool_unlock(pool);
+        if (payload) memset(payload, 0, payload_size);
+        return payload;
+    }
+
+    pool_magazine_t* mag = pool->magazines[slot];
+    if (!mag) {
+        mag = (pool_magazine_t*)calloc(1, sizeof(pool_magazine_t));
+        if (!mag) return NULL;
+        pool->magazines[slot] = mag;
+    }
+
+    // Refill the magazine in a batch when it runs dry
+    if (mag->count == 0) {
+        _pool_lock(pool);
+        while (mag->count < POOL_MAGAZINE_SIZE / 2) {
+            void* block = _pool_alloc_block_locked(pool);
+            if (!block) break;
+            mag->blocks[mag->count++] = block;
+        }
+        _pool_unlock(pool);
+        if (mag->count == 0) return NULL;
+    }
+
+    // Fast path: pop from the thread-local stack, no lock taken
+    void* payload = mag->blocks[--mag->count];
+
+    // Zero the payload to prevent use of stale data from previous allocations
+    memset(payload, 0, payload_size);
+    return payload;
+}
+
+void dynamic_pool_free(dynamic_pool_t* pool, void* ptr) {
+    if (!ptr) return;
+
+    int slot = _pool_thread_slot();
+
+    if (slot >= POOL_MAX_THREADS) {
+        _pool_lock(pool);
+        _pool_free_block_locked(pool, ptr);
+        _pool_unlock(pool);
+        return;
+    }
+
+    pool_magazine_t* mag = pool->magazines[slot];
+    if (!mag) {
+        mag = (pool_magazine_t*)calloc(1, sizeof(pool_magazine_t));
+        if (!mag) {
+            _pool_lock(pool);
+            _pool_free_block_locked(pool, ptr);
+            _pool_unlock(pool);
+            return;
+        }
+        pool->magazines[slot] = mag;
+    }
+
+    // Flush half the magazine back to the shared lists when it overflows
+    if (mag->count == POOL_MAGAZINE_SIZE) {
+        _pool_lock(pool);
+        while (mag->count > POOL_MAGAZINE_SIZE / 2) {
+            _pool_free_block_locked(pool, mag->blocks[--mag->count]);
+        }
+        _pool_unlock(pool);
+    }
+
+    // Fast path: push onto the thread-local stack, no lock taken
+    mag->blocks[mag->count++] = ptr;
+}
+
+/* Trim: release fully-empty pages back to the OS.
+ *
+ * Counterpart to the never-free policy in _pool_free_block_locked: after a
+ * transient allocation spike, empty pages would otherwise pin their memory
+ * for the life of the process. Keeps `keep_pages` empty pages warm as a
+ * watermark for the next burst and frees the rest. Magazine-cached blocks
+ * count as live on their page, so the magazines are flushed first; call
+ * this at an allocation lull (other threads quiescent), typically from
+ * NgTrimMemory(). Returns the number of pages released.
+ */
+size_t dynamic_pool_trim(dynamic_pool_t* pool, size_t keep_pages) {
+    size_t freed = 0;
+    _pool_lock(pool);
+
+    // Return cached blocks to their pages so empty pages become visible
+    for (int i = 0; i < POOL_MAX_THREADS; i++) {
+        pool_magazine_t* mag = pool->magazines[i];
+        if (!mag) continue;
+        while (mag->count > 0) {
+            _pool_free_block_locked(pool, mag->blocks[--mag->count]);
+        }
+    }
+
+    size_t empty_kept = 0;
+    pool_page_t* curr = pool->partial_pages;
+    while (curr) {
+        pool_page_t* next = curr->next;
+        if (curr->used_count == 0) {
+            if (empty_kept < keep_pages) {
+                empty_kept++;
+            } else {
+                _unlink_page(&pool->partial_pages, curr);
+                free(curr);
+                pool->page_count--;
+                freed++;
+            }
+        }
+        curr = next;
+    }
+
+    _pool_unlock(pool);
+    return freed;
+}
+
+/* Snapshot one pool's occupancy for the stats report (NAGINI_STATS /
+ * NgRuntimeStats). Blocks sitting in thread magazines are free from the
+ * caller's point of view but still count as used on their page, so they
+ * are subtracted back out. Takes the lock, so call it from a report
+ * path, not a hot one. */
+void dynamic_pool_stats(dynamic_pool_t* pool, size_t* pages, size_t* pages_high_water,
+                        size_t* blocks_in_use, size_t* blocks_capacity) {
+    *pages = 0;
+    *pages_high_water = 0;
+    *blocks_in_use = 0;
+    *blocks_capacity = 0;
+    if (!pool) return;
+
+    _pool_lock(pool);
+    size_t used = 0;
+    for (pool_page_t* p = pool->partial_pages; p; p = p->next) used += p->used_count;
+    for (pool_page_t* p = pool->full_pages; p; p = p->next) used += p->used_count;
+    for (int i = 0; i < POOL_MAX_THREADS; i++) {
+        pool_magazine_t* mag = pool->magazines[i];
+        if (mag) used -= mag->count;
+    }
+    *pages = pool->page_count;
+    *pages_high_water = pool->page_high_water;
+    *blocks_in_use = used;
+    *blocks_capacity = pool->page_count * pool->blocks_per_page;
+    _pool_unlock(pool);
+}
+
 void dynamic_pool_destroy(dynamic_pool_t* pool) {
     if (!pool) return;
 
+    // Magazines only cache blocks that live inside the pages below
+    for (int i = 0; i < POOL_MAX_THREADS; i++) {
+        free(pool->magazines[i]);
+    }
+
     // Helper to free a list of pages
     pool_page_t* lists[] = { pool->partial_pages, pool->full_pages };
     
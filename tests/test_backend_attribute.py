@@ -0,0 +1,49 @@
+import unittest
+
+from nagini.compiler import NaginiParser, NaginiIR, LLVMBackend
+
+
+class BackendAttributeTests(unittest.TestCase):
+    def _generate_code(self, source: str) -> str:
+        parser = NaginiParser()
+        classes, functions, top_level = parser.parse(source)
+        ir = NaginiIR(classes, functions, top_level).generate()
+        backend = LLVMBackend(ir)
+        return backend.generate()
+
+    def test_attribute_read_uses_inline_cache(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    x = obj.field\n"
+        )
+        self.assertIn("static NgMemberCache", code)
+        self.assertIn("NgGetMemberCached(runtime, obj, runtime->constants[", code)
+
+    def test_method_call_uses_inline_cache(self):
+        # The call result is consumed within the statement, so the lookup
+        # borrows the owner's reference instead of taking a new one.
+        code = self._generate_code(
+            "def main():\n"
+            "    obj.method()\n"
+        )
+        self.assertIn("NgGetMemberCachedBorrowed(runtime, obj, runtime->constants[", code)
+
+    def test_condition_read_borrows_reference(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    if obj.flag:\n"
+            "        x = 1\n"
+        )
+        self.assertIn("NgGetMemberCachedBorrowed(runtime, obj, runtime->constants[", code)
+
+    def test_range_loop_reuses_counter_box(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    for i in range(10):\n"
+            "        x = i\n"
+        )
+        self.assertIn("i = ng_int_reuse(runtime, i, ", code)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,77 @@
+import unittest
+
+from nagini.compiler import NaginiParser, NaginiIR, LLVMBackend
+
+
+class BackendCallTests(unittest.TestCase):
+    def _generate_code(self, source: str) -> str:
+        parser = NaginiParser()
+        classes, functions, top_level = parser.parse(source)
+        ir = NaginiIR(classes, functions, top_level).generate()
+        backend = LLVMBackend(ir)
+        return backend.generate()
+
+    def test_direct_call_uses_stack_tuple(self):
+        code = self._generate_code(
+            "def add(a, b):\n"
+            "    return a + b\n"
+            "def main():\n"
+            "    x = add(1, 2)\n"
+        )
+        self.assertIn("struct { Tuple t; Object* rest[2]; }", code)
+        self.assertIn("NG_IMMORTAL_REFCOUNT", code)
+
+    def test_open_maps_to_file_builtin(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    f = open(\"data.bin\", \"m\")\n"
+        )
+        self.assertIn("NgFileOpen(runtime, (Tuple*)", code)
+
+    def test_functions_maintain_profile_trace(self):
+        code = self._generate_code(
+            "def work(a):\n"
+            "    return a\n"
+            "def main():\n"
+            "    x = work(1)\n"
+        )
+        self.assertIn('ng_trace_push(runtime, "work")', code)
+        self.assertIn("if (runtime->profile.active) ng_trace_pop(runtime);", code)
+
+    def test_gc_collect_maps_to_collector_builtin(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    n = gc_collect()\n"
+        )
+        self.assertIn("NgGcCollect(runtime, NULL, NULL)", code)
+
+    def test_runtime_stats_maps_to_stats_builtin(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    s = runtime_stats()\n"
+        )
+        self.assertIn("NgRuntimeStats(runtime, NULL, NULL)", code)
+
+    def test_spawn_resolves_function_pointer_at_compile_time(self):
+        code = self._generate_code(
+            "def worker(n):\n"
+            "    return n\n"
+            "def main():\n"
+            "    t = spawn(worker, 5)\n"
+            "    r = join(t)\n"
+        )
+        self.assertIn("NgSpawn(runtime, &worker_", code)
+        self.assertIn("NgJoin(runtime, (Tuple*)", code)
+
+    def test_zero_arg_call_passes_null(self):
+        code = self._generate_code(
+            "def f():\n"
+            "    return 1\n"
+            "def main():\n"
+            "    x = f()\n"
+        )
+        self.assertIn("(runtime, NULL, NULL)", code)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,36 @@
+import unittest
+
+from nagini.compiler import NaginiParser, NaginiIR, LLVMBackend
+
+
+class BackendLoopTests(unittest.TestCase):
+    def _generate_code(self, source: str) -> str:
+        parser = NaginiParser()
+        classes, functions, top_level = parser.parse(source)
+        ir = NaginiIR(classes, functions, top_level).generate()
+        backend = LLVMBackend(ir)
+        return backend.generate()
+
+    def test_range_loop_lowers_to_native_for(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    for i in range(10):\n"
+            "        x = i\n"
+        )
+        self.assertIn("for (int64_t __i", code)
+        self.assertIn("ng_int_reuse(runtime, i, __i", code)
+
+    def test_container_loop_indexes_lists_directly(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    for x in data:\n"
+            "        y = x\n"
+        )
+        self.assertIn("->__flags__.type == OBJ_TYPE_LIST", code)
+        self.assertIn("LIST_STORE_I64", code)
+        # Non-list iterables still go through the iterator protocol
+        self.assertIn("NgIterNext", code)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,85 @@
+import unittest
+
+from nagini.compiler import NaginiParser, NaginiIR, LLVMBackend
+
+
+class BackendNexcPersistTests(unittest.TestCase):
+    def _generate_code(self, source: str) -> str:
+        parser = NaginiParser()
+        classes, functions, top_level = parser.parse(source)
+        ir = NaginiIR(classes, functions, top_level).generate()
+        backend = LLVMBackend(ir)
+        return backend.generate()
+
+    def test_persist_wraps_heap_array(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    with nexc('cpu') as optim:\n"
+            "        data = optim.zeros(10, type=optim.fp64)\n"
+            "        buf = optim.persist(data)\n"
+        )
+        self.assertIn("Object* buf = NULL;", code)
+        self.assertIn("double* data = (double*) malloc(sizeof(double) * (10));", code)
+        self.assertIn("buf = ng_buffer_wrap(runtime, data, sizeof(double) * (10), sizeof(double));", code)
+
+    def test_buffer_reattaches_as_view(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    with nexc('cpu') as optim:\n"
+            "        data = optim.zeros(10, type=optim.fp64)\n"
+            "        buf = optim.persist(data)\n"
+            "    with nexc('cpu') as optim:\n"
+            "        view = optim.buffer(buf, type=optim.fp64)\n"
+        )
+        self.assertIn("double* view = (double*) ng_buffer_data(runtime, buf);", code)
+
+    def test_persisted_record_list_moves_to_heap(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    with nexc('cpu') as optim:\n"
+            "        Point = optim.struct(x=optim.fp32, y=optim.fp32)\n"
+            "        pts = optim.list(8, type=Point)\n"
+            "        pb = optim.persist(pts)\n"
+        )
+        self.assertIn("Point* pts = (Point*) malloc(sizeof(Point) * (8));", code)
+        self.assertIn("pb = ng_buffer_wrap(runtime, pts, sizeof(Point) * (8), sizeof(Point));", code)
+
+    def test_persist_rejects_soa_list(self):
+        with self.assertRaises(ValueError):
+            self._generate_code(
+                "def main():\n"
+                "    with nexc('cpu') as optim:\n"
+                "        Point = optim.struct(x=optim.fp32, y=optim.fp32)\n"
+                "        pts = optim.list(8, type=Point, layout='soa')\n"
+                "        pb = optim.persist(pts)\n"
+            )
+
+    def test_struct_list_aos_uses_struct_members(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    with nexc('cpu') as optim:\n"
+            "        Point = optim.struct(x=optim.fp32, y=optim.fp32)\n"
+            "        pts = optim.list(8, type=Point)\n"
+            "        for i in range(8):\n"
+            "            pts[i].x = pts[i].y\n"
+        )
+        self.assertIn("typedef struct { float x; float y; } Point;", code)
+        self.assertIn("Point pts[8] __attribute__((aligned(32)));", code)
+        self.assertIn("pts[i].x = pts[i].y;", code)
+
+    def test_struct_list_soa_splits_fields_into_arrays(self):
+        code = self._generate_code(
+            "def main():\n"
+            "    with nexc('cpu') as optim:\n"
+            "        Point = optim.struct(x=optim.fp32, y=optim.fp32)\n"
+            "        pts = optim.list(8, type=Point, layout='soa')\n"
+            "        for i in range(8):\n"
+            "            pts[i].x = pts[i].x + pts[i].y\n"
+        )
+        self.assertIn("float pts_x[8] __attribute__((aligned(32)));", code)
+        self.assertIn("float pts_y[8] __attribute__((aligned(32)));", code)
+        self.assertIn("pts_x[i] = (pts_x[i] + pts_y[i]);", code)
+
+
+if __name__ == "__main__":
+    unittest.main()